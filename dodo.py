@@ -30,3 +30,75 @@ def task_test():
             subprocess.run(str(exe.relative_to("build")), shell=True, cwd="build")
 
     return {"actions": [run], "task_dep": ["build"]}
+
+
+def find_benchmark_exe():
+    exes = list(pathlib.Path("build").rglob("libUncertainty_benchmarks"))
+    if len(exes) < 1:
+        raise RuntimeError("Could not find libUncertainty_benchmarks executable. Did the build fail?")
+    return exes[0]
+
+
+def task_benchmark():
+    """Run the benchmarks and write the results to build/benchmark_results.json"""
+
+    def run():
+        subprocess.run(
+            [str(find_benchmark_exe()), "--repetitions", "10", "--output", "build/benchmark_results.json"],
+            check=True,
+        )
+
+    return {"actions": [run], "task_dep": ["build"], "targets": ["build/benchmark_results.json"]}
+
+
+def task_save_benchmark_baseline():
+    """Store the latest benchmark results as the baseline for future comparisons."""
+    return {
+        "actions": ["cp build/benchmark_results.json build/benchmark_baseline.json"],
+        "task_dep": ["benchmark"],
+    }
+
+
+def task_compare_benchmarks():
+    """Compare the latest benchmark results to the stored baseline."""
+    return {
+        "actions": [
+            "python scripts/compare_benchmarks.py build/benchmark_baseline.json build/benchmark_results.json"
+        ],
+        "file_dep": ["build/benchmark_baseline.json"],
+        "task_dep": ["benchmark"],
+        "uptodate": [False],
+    }
+
+
+def task_compile_time_benchmark():
+    """Measure the compile-time cost of the headers and check it against the budget in testing/compile_time_budget.json."""
+
+    def run():
+        # cmake_layout puts the build in a subdirectory (build/Release), find the one with the compile commands.
+        dbs = list(pathlib.Path("build").rglob("compile_commands.json"))
+        if len(dbs) < 1:
+            raise RuntimeError("Could not find compile_commands.json. Did the configure step fail?")
+        baseline = pathlib.Path("build/compile_time_baseline.json")
+        cmd = [
+            "python",
+            "scripts/compile_time_benchmark.py",
+            str(dbs[0].parent),
+            "--output",
+            "build/compile_time_results.json",
+            "--budget",
+            "testing/compile_time_budget.json",
+        ]
+        if baseline.exists():
+            cmd += ["--baseline", str(baseline)]
+        return subprocess.run(cmd).returncode == 0
+
+    return {"actions": [run], "task_dep": ["build"], "uptodate": [False]}
+
+
+def task_save_compile_time_baseline():
+    """Store the latest compile-time results as the baseline for future comparisons."""
+    return {
+        "actions": ["cp build/compile_time_results.json build/compile_time_baseline.json"],
+        "file_dep": ["build/compile_time_results.json"],
+    }
@@ -0,0 +1,145 @@
+"""
+Compare two sets of results written by libUncertainty_benchmarks.
+
+usage: python scripts/compare_benchmarks.py BASELINE.json CURRENT.json [--alpha 0.01] [--threshold 0.05]
+
+A benchmark is flagged as a regression if its mean time per operation increased by more
+than the threshold (relative) and Welch's t-test on the per-repetition samples says the
+increase is significant at the given level. Any increase in the number of allocations or
+function evaluations per operation is always flagged, those counts are deterministic.
+
+The exit status is 1 if any regression was found.
+"""
+import argparse
+import json
+import math
+import sys
+
+
+def betacf(a, b, x):
+    """Continued fraction for the incomplete beta function (Numerical Recipes)."""
+    tiny = 1e-300
+    qab = a + b
+    qap = a + 1
+    qam = a - 1
+    c = 1.0
+    d = 1.0 - qab * x / qap
+    if abs(d) < tiny:
+        d = tiny
+    d = 1.0 / d
+    h = d
+    for m in range(1, 300):
+        m2 = 2 * m
+        aa = m * (b - m) * x / ((qam + m2) * (a + m2))
+        d = 1.0 + aa * d
+        if abs(d) < tiny:
+            d = tiny
+        c = 1.0 + aa / c
+        if abs(c) < tiny:
+            c = tiny
+        d = 1.0 / d
+        h *= d * c
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2))
+        d = 1.0 + aa * d
+        if abs(d) < tiny:
+            d = tiny
+        c = 1.0 + aa / c
+        if abs(c) < tiny:
+            c = tiny
+        d = 1.0 / d
+        delta = d * c
+        h *= delta
+        if abs(delta - 1.0) < 1e-12:
+            break
+    return h
+
+
+def betai(a, b, x):
+    """Regularized incomplete beta function I_x(a,b)."""
+    if x <= 0:
+        return 0.0
+    if x >= 1:
+        return 1.0
+    lbeta = math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b)
+    bt = math.exp(lbeta + a * math.log(x) + b * math.log(1 - x))
+    if x < (a + 1) / (a + b + 2):
+        return bt * betacf(a, b, x) / a
+    return 1.0 - bt * betacf(b, a, 1 - x) / b
+
+
+def welch_t_test(x, y):
+    """
+    One sided Welch's t-test for mean(y) > mean(x).
+
+    Returns the p-value.
+    """
+    nx, ny = len(x), len(y)
+    if nx < 2 or ny < 2:
+        return float("nan")
+    mx, my = sum(x) / nx, sum(y) / ny
+    vx = sum((v - mx) ** 2 for v in x) / (nx - 1)
+    vy = sum((v - my) ** 2 for v in y) / (ny - 1)
+    se2 = vx / nx + vy / ny
+    if se2 == 0:
+        return 0.0 if my > mx else 1.0
+    t = (my - mx) / math.sqrt(se2)
+    df = se2**2 / ((vx / nx) ** 2 / (nx - 1) + (vy / ny) ** 2 / (ny - 1))
+    # P(T > t) for a t distribution with df degrees of freedom
+    p_two_sided = betai(df / 2, 0.5, df / (df + t * t))
+    return p_two_sided / 2 if t > 0 else 1 - p_two_sided / 2
+
+
+def load(filename):
+    with open(filename) as f:
+        data = json.load(f)
+    results = {}
+    for b in data["benchmarks"]:
+        key = "/".join([b["name"]] + [f"{k}={v}" for k, v in sorted(b["params"].items())])
+        results[key] = b
+    return results
+
+
+def compare(baseline, current, alpha, threshold):
+    regressions = []
+    rows = []
+    for key, cur in current.items():
+        if key not in baseline:
+            continue
+        base = baseline[key]
+        change = cur["ns_per_op"] / base["ns_per_op"] - 1 if base["ns_per_op"] > 0 else 0
+        p = welch_t_test(base["ns_per_op_samples"], cur["ns_per_op_samples"])
+        flags = []
+        if change > threshold and p < alpha:
+            flags.append("SLOWER")
+        for counter in ["allocations_per_op", "evaluations_per_op"]:
+            if cur.get(counter, 0) > base.get(counter, 0):
+                flags.append(f"MORE {counter.replace('_per_op', '').upper()}")
+        rows.append((key, base["ns_per_op"], cur["ns_per_op"], change, p, " ".join(flags)))
+        if flags:
+            regressions.append(key)
+    return rows, regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare libUncertainty benchmark results against a baseline.")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--alpha", type=float, default=0.01, help="significance level for the t-test.")
+    parser.add_argument("--threshold", type=float, default=0.05, help="minimum relative slowdown to report.")
+    args = parser.parse_args()
+
+    rows, regressions = compare(load(args.baseline), load(args.current), args.alpha, args.threshold)
+    width = max([len(r[0]) for r in rows] + [9])
+    print(f"{'benchmark':{width}}  {'baseline':>12}  {'current':>12}  {'change':>8}  {'p':>8}")
+    for key, base, cur, change, p, flags in rows:
+        print(f"{key:{width}}  {base:12.2f}  {cur:12.2f}  {change:+8.1%}  {p:8.3g}  {flags}")
+
+    if regressions:
+        print(f"\n{len(regressions)} regression(s) found.")
+        return 1
+    print("\nNo regressions found.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
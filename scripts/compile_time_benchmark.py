@@ -0,0 +1,255 @@
+"""
+Measure the compile-time cost of the libUncertainty headers.
+
+usage: python scripts/compile_time_benchmark.py BUILD_DIR [--output FILE] [--budget FILE] [--baseline FILE]
+                                                [--threshold 0.1] [--repetitions 5]
+
+A set of small translation units, for the typical includes and calls with different arities,
+is compiled with the compiler and flags that the unit tests are built with. The flags are
+taken from BUILD_DIR/compile_commands.json. For each translation unit, we record:
+
+  preprocessed_lines  the number of lines after preprocessing (-E).
+  frontend_seconds    the best wall time of a syntax-only compile (-fsyntax-only) over the repetitions.
+  instantiations      the number of template instantiations (clang only, from -ftime-trace).
+  instantiated_symbols  the number of functions (and weak objects) defined in the object file compiled with -O0
+                      (from nm). Without optimization every template instantiation that is used is emitted,
+                      as a weak symbol, or a local one if it depends on a lambda, so this tracks the
+                      instantiation count with any compiler.
+  instantiation_seconds  the time spent instantiating templates (from -ftime-trace with clang, -ftime-report with gcc).
+
+The counts only depend on the compiler and standard library, not on the machine, so they are
+checked against the limits in the budget file (testing/compile_time_budget.json). A limit is
+skipped if the compiler does not report the value (instantiation counts need clang). Times depend
+on the machine, so they are only compared against a baseline measured on the same machine (like
+compare_benchmarks.py does for runtime results), a case is flagged if it is slower than the
+baseline by more than the threshold.
+
+The exit status is 1 if a case is over budget or slower than the baseline.
+"""
+import argparse
+import json
+import os
+import pathlib
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+PREAMBLE = "#include <libUncertainty/propagate.hpp>\n#include <libUncertainty/uncertain.hpp>\nusing namespace libUncertainty;\n"
+CORE_PREAMBLE = "#include <libUncertainty/propagate_core.hpp>\nusing namespace libUncertainty;\n"
+
+
+def call_case(arity, mode="plain"):
+    """A translation unit that propagates error through a function with `arity` arguments."""
+    if mode == "quantity":
+        arg_type = "boost::units::quantity<t::m>"
+        preamble = "#include <BoostUnitDefinitions/Units.hpp>\n" + PREAMBLE
+        value = "uncertain<boost::units::quantity<t::m>>(1 * i::m, 0.1 * i::m)"
+    else:
+        arg_type = "double"
+        preamble = CORE_PREAMBLE if mode == "core" else PREAMBLE
+        value = "uncertain<double>(1, 0.1)"
+    if mode == "store":
+        preamble = "#include <libUncertainty/correlation.hpp>\n" + preamble
+        value = "add_id<uncertain<double>>(1, 0.1)"
+    params = ", ".join(f"{arg_type} x{i}" for i in range(arity))
+    body = " + ".join(f"x{i}" for i in range(arity))
+    args = ", ".join(value for _ in range(arity))
+    store = "store, " if mode == "store" else ""
+    store_decl = "  correlation_store<double> store;\n" if mode == "store" else ""
+    return (
+        preamble
+        + "auto f() {\n"
+        + store_decl
+        + f"  return basic_error_propagator::propagate_error([]({params}) {{ return {body}; }}, {store}{args});\n"
+        + "}\n"
+    )
+
+
+CASES = {
+    "include_uncertain": "#include <libUncertainty/uncertain.hpp>\n",
+    "include_uncertain_core": "#include <libUncertainty/uncertain_core.hpp>\n",
+    "include_propagate": "#include <libUncertainty/propagate.hpp>\n",
+    "include_propagate_core": "#include <libUncertainty/propagate_core.hpp>\n",
+    "call_arity_1": call_case(1),
+    "call_arity_5": call_case(5),
+    "call_arity_10": call_case(10),
+    "call_arity_20": call_case(20),
+    "call_arity_5_core": call_case(5, "core"),
+    "call_arity_5_store": call_case(5, "store"),
+    "call_arity_5_quantity": call_case(5, "quantity"),
+}
+
+
+def find_compile_command(build_dir):
+    """Return the compiler command (as a list) used for one of the unit test sources."""
+    db = pathlib.Path(build_dir) / "compile_commands.json"
+    if not db.exists():
+        raise RuntimeError(f"{db} does not exist. Configure the build with CMAKE_EXPORT_COMPILE_COMMANDS=ON.")
+    for entry in json.loads(db.read_text()):
+        if "CatchTests" in entry["file"]:
+            args = entry["arguments"] if "arguments" in entry else shlex.split(entry["command"])
+            return args, entry["directory"]
+    raise RuntimeError(f"Could not find the unit test compile command in {db}.")
+
+
+def strip_args(args):
+    """Remove the source, output and compile-only arguments from a compile command."""
+    out = []
+    skip = False
+    for a in args:
+        if skip:
+            skip = False
+            continue
+        if a in ["-o", "-c", "-MF", "-MT", "-MQ"]:
+            skip = a != "-c"
+            continue
+        if a in ["-MD", "-MMD"] or a.endswith((".cpp", ".cc", ".cxx")):
+            continue
+        out.append(a)
+    return out
+
+
+# the results that can be checked against the budget file. times are only compared to a baseline.
+BUDGET_KEYS = ["preprocessed_lines", "instantiations", "instantiated_symbols"]
+
+
+def count_defined_symbols(obj):
+    """Return the number of functions and weak objects defined in an object file, or None without nm."""
+    nm = shutil.which("nm")
+    if nm is None:
+        return None
+    out = subprocess.run([nm, "--defined-only", str(obj)], capture_output=True, text=True, check=True).stdout
+    return sum(1 for line in out.splitlines() if len(line.split()) >= 3 and line.split()[1] in ["T", "t", "W", "w", "V", "v"])
+
+
+def is_clang(compiler):
+    try:
+        version = subprocess.run([compiler, "--version"], capture_output=True, text=True).stdout
+    except OSError:
+        return False
+    return "clang" in version
+
+
+def parse_time_trace(filename):
+    with open(filename) as f:
+        events = json.load(f)["traceEvents"]
+    instantiations = 0
+    seconds = 0.0
+    for e in events:
+        if e.get("name") in ["InstantiateFunction", "InstantiateClass"]:
+            instantiations += 1
+        # the totals are reported as events named "Total <name>"
+        if e.get("name") in ["Total InstantiateFunction", "Total InstantiateClass"]:
+            seconds += e.get("dur", 0) / 1e6
+    return instantiations, seconds
+
+
+def parse_time_report(text):
+    """Return the wall time of the template instantiation phase from gcc's -ftime-report output."""
+    for line in text.splitlines():
+        if line.strip().startswith("template instantiation"):
+            m = re.findall(r"(\d+\.\d+)\s*\(\s*\d+%\)", line)
+            if len(m) >= 3:
+                return float(m[2])
+    return None
+
+
+def measure(name, source, compiler, flags, cwd, repetitions, tmpdir):
+    src = pathlib.Path(tmpdir) / f"{name}.cpp"
+    src.write_text(source)
+    result = {"name": name}
+
+    pp = subprocess.run([compiler] + flags + ["-E", "-P", str(src)], capture_output=True, text=True, cwd=cwd)
+    if pp.returncode != 0:
+        raise RuntimeError(f"Could not preprocess case {name}:\n{pp.stderr}")
+    result["preprocessed_lines"] = pp.stdout.count("\n")
+
+    times = []
+    for _ in range(repetitions):
+        start = time.perf_counter()
+        subprocess.run([compiler] + flags + ["-fsyntax-only", str(src)], check=True, cwd=cwd)
+        times.append(time.perf_counter() - start)
+    result["frontend_seconds"] = min(times)
+    result["frontend_seconds_samples"] = times
+
+    # without optimization every instantiation that is used is emitted out of line, so it shows up in the symbol table
+    unoptimized = pathlib.Path(tmpdir) / f"{name}.O0.o"
+    subprocess.run([compiler] + flags + ["-O0", "-c", str(src), "-o", str(unoptimized)], check=True, cwd=cwd)
+    result["instantiated_symbols"] = count_defined_symbols(unoptimized)
+
+    if is_clang(compiler):
+        obj = pathlib.Path(tmpdir) / f"{name}.o"
+        subprocess.run([compiler] + flags + ["-ftime-trace", "-c", str(src), "-o", str(obj)], check=True, cwd=cwd)
+        result["instantiations"], result["instantiation_seconds"] = parse_time_trace(obj.with_suffix(".json"))
+    else:
+        report = subprocess.run([compiler] + flags + ["-ftime-report", "-fsyntax-only", str(src)], capture_output=True, text=True, cwd=cwd)
+        result["instantiation_seconds"] = parse_time_report(report.stderr)
+    return result
+
+
+def check(results, budget, baseline, threshold):
+    problems = []
+    for r in results:
+        limits = budget.get("cases", {}).get(r["name"], {})
+        for key, limit in limits.items():
+            if key not in BUDGET_KEYS:
+                raise RuntimeError(f"{key} can not be budgeted, only {', '.join(BUDGET_KEYS)} (times are compared to a baseline).")
+            if r.get(key) is not None and r[key] > limit:
+                problems.append(f"{r['name']}: {key} = {r[key]} is over the budget of {limit}")
+        base = baseline.get(r["name"]) if baseline else None
+        if base:
+            change = r["frontend_seconds"] / base["frontend_seconds"] - 1 if base["frontend_seconds"] > 0 else 0
+            if change > threshold:
+                problems.append(f"{r['name']}: frontend time increased by {change:.1%} relative to the baseline")
+    return problems
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Measure the compile-time cost of the libUncertainty headers.")
+    parser.add_argument("build_dir")
+    parser.add_argument("--output", help="write the results as JSON to this file.")
+    parser.add_argument("--budget", help="check the results against the limits in this file.")
+    parser.add_argument("--baseline", help="compare the times to the results in this file.")
+    parser.add_argument("--threshold", type=float, default=0.1, help="maximum relative slowdown compared to the baseline.")
+    parser.add_argument("--repetitions", type=int, default=5)
+    args = parser.parse_args()
+
+    command, cwd = find_compile_command(args.build_dir)
+    compiler, flags = command[0], strip_args(command[1:])
+    with tempfile.TemporaryDirectory() as tmpdir:
+        results = [measure(name, source, compiler, flags, cwd, args.repetitions, tmpdir) for name, source in CASES.items()]
+
+    print(f"{'case':24}  {'pp lines':>9}  {'frontend s':>10}  {'inst.':>7}  {'symbols':>7}  {'inst. s':>8}")
+    for r in results:
+        inst = r.get("instantiations")
+        syms = r.get("instantiated_symbols")
+        inst_s = r.get("instantiation_seconds")
+        print(
+            f"{r['name']:24}  {r['preprocessed_lines']:9d}  {r['frontend_seconds']:10.3f}  "
+            f"{inst if inst is not None else '-':>7}  {syms if syms is not None else '-':>7}  "
+            f"{inst_s if inst_s is not None else float('nan'):8.3f}"
+        )
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump({"compiler": compiler, "cases": results}, f, indent=2)
+
+    budget = json.loads(pathlib.Path(args.budget).read_text()) if args.budget else {}
+    baseline = None
+    if args.baseline and os.path.exists(args.baseline):
+        baseline = {r["name"]: r for r in json.loads(pathlib.Path(args.baseline).read_text())["cases"]}
+    problems = check(results, budget, baseline, args.threshold)
+    if problems:
+        print()
+        for p in problems:
+            print(p)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
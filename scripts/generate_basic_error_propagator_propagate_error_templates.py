@@ -38,7 +38,7 @@ def print_instance(n):
       print(f'if( is_uncertain(a_a{i}) ) '+'{')
       print(f'a_deviations[{i}]= a_f(',', '.join(function_call_args)+') - nominal;')
       print("}else{")
-      print(f"a_deviations[{i}] = nominal - nominal; // can't just use 0 here, we might be dealing with quantities that have units")
+      print(f"a_deviations[{i}] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units")
       print("}")
       function_call_args[i] = function_call_args[i].replace('upper','nominal')
   print("return nominal;")
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "./uncertain.hpp"
+#include "./utils.hpp"
+
+/** @file archive.hpp
+ * @brief Compact encoding for storing columns of uncertain values.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+/**
+ * Options controlling how a column of uncertain values is encoded.
+ *
+ * The uncertainty is always quantized to `uncertainty_sigfigs` significant figures (the same rounding
+ * done by uncertain<...>::normalize(...)). By default, the nominal values are stored losslessly using a
+ * Gorilla-style XOR delta. If `quantize_nominal` is true, the nominal value is rounded to the decimal
+ * position of the last significant figure of the uncertainty (again, like normalize(...)) and stored as
+ * an integer difference from the previous value, which is much smaller.
+ */
+struct archive_options {
+  size_t uncertainty_sigfigs = 2;
+  bool   quantize_nominal    = false;
+};
+
+namespace detail
+{
+/**
+ * Append bits to a byte buffer, most significant bit first.
+ */
+class bit_writer
+{
+ public:
+  explicit bit_writer(std::vector<std::uint8_t>& a_buffer) : m_buffer(a_buffer) {}
+
+  void write(std::uint64_t a_bits, unsigned a_n)
+  {
+    while(a_n > 0) {
+      if(m_free == 0) {
+        m_buffer.push_back(0);
+        m_free = 8;
+      }
+      unsigned     n    = std::min(a_n, m_free);
+      std::uint8_t bits = static_cast<std::uint8_t>((a_bits >> (a_n - n)) & ((1u << n) - 1));
+      m_buffer.back() |= static_cast<std::uint8_t>(bits << (m_free - n));
+      m_free -= n;
+      a_n -= n;
+    }
+  }
+
+ private:
+  std::vector<std::uint8_t>& m_buffer;
+  unsigned                   m_free = 0;
+};
+
+/**
+ * Read bits written by bit_writer.
+ */
+class bit_reader
+{
+ public:
+  bit_reader(const std::uint8_t* a_begin, const std::uint8_t* a_end) : m_pos(a_begin), m_end(a_end) {}
+
+  std::uint64_t read(unsigned a_n)
+  {
+    std::uint64_t bits = 0;
+    while(a_n > 0) {
+      if(m_pos == m_end) {
+        throw std::runtime_error("Unexpected end of uncertain column archive.");
+      }
+      unsigned n = std::min(a_n, 8 - m_used);
+      bits       = (bits << n) | ((*m_pos >> (8 - m_used - n)) & ((1u << n) - 1));
+      m_used += n;
+      a_n -= n;
+      if(m_used == 8) {
+        ++m_pos;
+        m_used = 0;
+      }
+    }
+    return bits;
+  }
+
+ private:
+  const std::uint8_t* m_pos;
+  const std::uint8_t* m_end;
+  unsigned            m_used = 0;
+};
+
+// multiply by 10^k. 10^k is exact for |k| <= 22, so dividing gives a correctly
+// rounded result for negative exponents where multiplying by 10^-k would not.
+inline double scale_pow10(double a_val, int a_exp)
+{
+  return a_exp >= 0 ? a_val * std::pow(10., a_exp) : a_val / std::pow(10., -a_exp);
+}
+
+// number of bits needed to store a mantissa with n significant figures
+inline unsigned mantissa_bits(size_t a_n)
+{
+  return std::bit_width(static_cast<std::uint64_t>(std::pow(10., a_n)));
+}
+
+constexpr std::uint8_t archive_magic[4] = {'L', 'U', 'C', 'A'};
+constexpr std::uint8_t archive_version  = 1;
+constexpr unsigned     exponent_bits    = 10;  // decimal exponents of doubles are in [-324,308]
+}  // namespace detail
+
+/**
+ * Encode a sequence of uncertain values into a compact byte buffer.
+ *
+ * The nominal value and uncertainty of each element are converted to double.
+ *
+ * @param begin iterator pointing to beginning of range.
+ * @param end iterator pointing to end of range.
+ * @param a_opts encoding options.
+ */
+template<typename iterator>
+std::vector<std::uint8_t> encode_uncertain_column(iterator begin, iterator end, archive_options a_opts = {})
+{
+  if(a_opts.uncertainty_sigfigs < 1 || a_opts.uncertainty_sigfigs > 15) {
+    throw std::invalid_argument("Uncertain column archives support 1 to 15 significant figures for the uncertainty.");
+  }
+
+  std::vector<double> nominals;
+  std::vector<double> uncertainties;
+  for(auto it = begin; it != end; ++it) {
+    nominals.push_back(static_cast<double>(get_nominal(*it)));
+    uncertainties.push_back(static_cast<double>(get_uncertainty(*it)));
+  }
+  const size_t N = nominals.size();
+
+  // quantize the uncertainties first. this is a simple loop over contiguous memory that
+  // the compiler can vectorize, the bit packing below is inherently serial.
+  const size_t        n          = a_opts.uncertainty_sigfigs;
+  const unsigned      m_bits     = detail::mantissa_bits(n);
+  const std::uint64_t m_escape   = (std::uint64_t(1) << m_bits) - 1;
+  const double        m_max      = std::pow(10., n);
+  std::vector<int>    exponents(N);
+  std::vector<double> mantissas(N);
+  for(size_t i = 0; i < N; ++i) {
+    double unc   = std::abs(uncertainties[i]);
+    exponents[i] = unc > 0 && std::isfinite(unc) ? static_cast<int>(std::floor(std::log10(unc))) : 0;
+    mantissas[i] = std::nearbyint(detail::scale_pow10(unc, static_cast<int>(n) - 1 - exponents[i]));
+  }
+
+  std::vector<std::uint8_t> buffer(std::begin(detail::archive_magic), std::end(detail::archive_magic));
+  buffer.push_back(detail::archive_version);
+  buffer.push_back(static_cast<std::uint8_t>(n));
+  buffer.push_back(a_opts.quantize_nominal ? 1 : 0);
+  for(int i = 0; i < 8; ++i) {
+    buffer.push_back(static_cast<std::uint8_t>(static_cast<std::uint64_t>(N) >> (8 * i)));
+  }
+
+  detail::bit_writer out(buffer);
+  int                last_exp = std::numeric_limits<int>::min();
+  std::int64_t       last_q   = 0;
+  std::uint64_t      last_nom = 0;
+  unsigned           last_lz = 0, last_tz = 0;
+  bool               have_window = false;
+  for(size_t i = 0; i < N; ++i) {
+    // uncertainty: [exponent] mantissa
+    double unc      = std::abs(uncertainties[i]);
+    int    exp      = exponents[i];
+    double mantissa = mantissas[i];
+    // log10 is not exact, fix up mantissas that ended up outside of [10^(n-1),10^n)
+    if(mantissa >= m_max) {
+      exp += 1;
+      mantissa = std::nearbyint(detail::scale_pow10(unc, static_cast<int>(n) - 1 - exp));
+    } else if(mantissa > 0 && mantissa < m_max / 10) {
+      exp -= 1;
+      mantissa = std::nearbyint(detail::scale_pow10(unc, static_cast<int>(n) - 1 - exp));
+    }
+    bool raw_unc = !std::isfinite(unc) || mantissa >= m_max;
+    if(raw_unc || unc == 0) {
+      out.write(raw_unc ? m_escape : 0, m_bits);
+      if(raw_unc) {
+        out.write(std::bit_cast<std::uint64_t>(uncertainties[i]), 64);
+      }
+    } else {
+      out.write(static_cast<std::uint64_t>(mantissa), m_bits);
+      if(exp == last_exp) {
+        out.write(0, 1);
+      } else {
+        out.write(1, 1);
+        out.write(static_cast<std::uint64_t>(exp) & ((1u << detail::exponent_bits) - 1), detail::exponent_bits);
+        last_exp = exp;
+      }
+    }
+
+    // nominal
+    if(a_opts.quantize_nominal) {
+      // round the nominal value to the last significant figure of the uncertainty and store it as an integer.
+      // values that cannot be quantized are stored raw.
+      int    q_exp = exp - static_cast<int>(n) + 1;
+      double q     = std::nearbyint(detail::scale_pow10(nominals[i], -q_exp));
+      if(raw_unc || unc == 0 || !std::isfinite(q) || std::abs(q) >= 0x1p61) {
+        out.write(1, 1);
+        out.write(std::bit_cast<std::uint64_t>(nominals[i]), 64);
+      } else {
+        // store the difference from the previous integer, zig-zag encoded with a 6 bit length prefix
+        auto          qi     = static_cast<std::int64_t>(q);
+        auto          dq     = qi - last_q;
+        std::uint64_t zz     = (static_cast<std::uint64_t>(dq) << 1) ^ static_cast<std::uint64_t>(dq >> 63);
+        unsigned      length = std::bit_width(zz);
+        last_q               = qi;
+        out.write(0, 1);
+        out.write(length, 6);
+        out.write(zz, length);
+      }
+    } else {
+      std::uint64_t bits = std::bit_cast<std::uint64_t>(nominals[i]);
+      std::uint64_t xord = bits ^ last_nom;
+      last_nom           = bits;
+      if(xord == 0) {
+        out.write(0, 1);
+        continue;
+      }
+      out.write(1, 1);
+      unsigned lz = std::min(std::countl_zero(xord), 31);
+      unsigned tz = std::countr_zero(xord);
+      if(have_window && lz >= last_lz && tz >= last_tz) {
+        // meaningful bits fit inside the previous window
+        out.write(0, 1);
+        out.write(xord >> last_tz, 64 - last_lz - last_tz);
+      } else {
+        unsigned length = 64 - lz - tz;
+        out.write(1, 1);
+        out.write(lz, 5);
+        out.write(length - 1, 6);
+        out.write(xord >> tz, length);
+        last_lz     = lz;
+        last_tz     = tz;
+        have_window = true;
+      }
+    }
+  }
+
+  return buffer;
+}
+
+/**
+ * Decode a buffer created by encode_uncertain_column(...).
+ *
+ * Throws std::runtime_error if the buffer is not a valid archive.
+ */
+inline std::vector<uncertain<double>> decode_uncertain_column(const std::vector<std::uint8_t>& a_buffer)
+{
+  const size_t header_size = 4 + 3 + 8;
+  if(a_buffer.size() < header_size || !std::equal(std::begin(detail::archive_magic), std::end(detail::archive_magic), a_buffer.begin())) {
+    throw std::runtime_error("Buffer is not an uncertain column archive.");
+  }
+  if(a_buffer[4] != detail::archive_version) {
+    throw std::runtime_error("Unsupported uncertain column archive version " + std::to_string(a_buffer[4]) + ".");
+  }
+  const size_t n                = a_buffer[5];
+  const bool   quantize_nominal = a_buffer[6] & 1;
+  std::uint64_t N               = 0;
+  for(int i = 0; i < 8; ++i) {
+    N |= static_cast<std::uint64_t>(a_buffer[7 + i]) << (8 * i);
+  }
+  if(n < 1 || n > 15) {
+    throw std::runtime_error("Invalid number of significant figures (" + std::to_string(n) + ") in uncertain column archive.");
+  }
+
+  const unsigned      m_bits   = detail::mantissa_bits(n);
+  const std::uint64_t m_escape = (std::uint64_t(1) << m_bits) - 1;
+  // every element takes at least a mantissa and a one bit nominal flag, so a corrupt
+  // length is caught here instead of by a huge allocation.
+  if(N > (a_buffer.size() - header_size) * 8 / (m_bits + 1)) {
+    throw std::runtime_error("Uncertain column archive is too short for its " + std::to_string(N) + " elements.");
+  }
+
+  std::vector<uncertain<double>> ret;
+  ret.reserve(N);
+  detail::bit_reader in(a_buffer.data() + header_size, a_buffer.data() + a_buffer.size());
+  int                last_exp = 0;
+  std::int64_t       last_q   = 0;
+  std::uint64_t      last_nom = 0;
+  unsigned           last_lz = 0, last_tz = 0;
+  for(std::uint64_t i = 0; i < N; ++i) {
+    double        unc      = 0;
+    std::uint64_t mantissa = in.read(m_bits);
+    if(mantissa == m_escape) {
+      unc = std::bit_cast<double>(in.read(64));
+    } else if(mantissa != 0) {
+      if(in.read(1)) {
+        // sign extend the stored exponent
+        auto e   = in.read(detail::exponent_bits);
+        last_exp = static_cast<int>(e) - (e >> (detail::exponent_bits - 1) ? (1 << detail::exponent_bits) : 0);
+      }
+      unc = detail::scale_pow10(static_cast<double>(mantissa), last_exp - static_cast<int>(n) + 1);
+    }
+
+    double nom = 0;
+    if(quantize_nominal) {
+      if(in.read(1)) {
+        nom = std::bit_cast<double>(in.read(64));
+      } else {
+        unsigned      length = in.read(6);
+        std::uint64_t zz     = in.read(length);
+        last_q += static_cast<std::int64_t>(zz >> 1) ^ -static_cast<std::int64_t>(zz & 1);
+        nom = detail::scale_pow10(static_cast<double>(last_q), last_exp - static_cast<int>(n) + 1);
+      }
+    } else {
+      if(in.read(1)) {
+        std::uint64_t xord = 0;
+        if(in.read(1) == 0) {
+          xord = in.read(64 - last_lz - last_tz) << last_tz;
+        } else {
+          last_lz         = in.read(5);
+          unsigned length = in.read(6) + 1;
+          last_tz         = 64 - last_lz - length;
+          xord            = in.read(length) << last_tz;
+        }
+        last_nom ^= xord;
+      }
+      nom = std::bit_cast<double>(last_nom);
+    }
+    ret.emplace_back(nom, unc);
+  }
+
+  return ret;
+}
+
+}  // namespace libUncertainty
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "./uncertain_core.hpp"
+#include "./utils.hpp"
+
+/** @file async.hpp
+ * @brief Asynchronous error propagation for functions with a high latency.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+/**
+ * A simple fixed-size thread pool.
+ *
+ * This is the default executor for async_propagate_error(...). An executor is any object
+ * with an `execute(std::function<void()>)` method that runs the task (now or later, on any thread).
+ */
+class thread_pool
+{
+ public:
+  thread_pool(size_t a_threads = std::max(1u, std::thread::hardware_concurrency()))
+  {
+    for(size_t i = 0; i < std::max<size_t>(a_threads, 1); ++i) {
+      m_threads.emplace_back([this]() { work(); });
+    }
+  }
+  ~thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_condition.notify_all();
+    for(auto& t : m_threads) {
+      t.join();
+    }
+  }
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  size_t size() const { return m_threads.size(); }
+
+  void execute(std::function<void()> a_task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_tasks.push(std::move(a_task));
+    }
+    m_condition.notify_one();
+  }
+
+ private:
+  void work()
+  {
+    while(true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+        if(m_stop && m_tasks.empty()) {
+          return;
+        }
+        task = std::move(m_tasks.front());
+        m_tasks.pop();
+      }
+      task();
+    }
+  }
+
+  std::vector<std::thread>          m_threads;
+  std::queue<std::function<void()>> m_tasks;
+  std::mutex                        m_mutex;
+  std::condition_variable           m_condition;
+  bool                              m_stop = false;
+};
+
+/**
+ * Returns a reference to a static, global thread pool with one thread per core.
+ *
+ * The pool is sized for work that keeps a core busy. A latency-bound function with more than
+ * hardware_concurrency() - 1 uncertain arguments has more evaluations than threads, and the extra
+ * ones wait for a thread to become free. Pass a thread_pool with (at least) N+1 threads to
+ * async_propagate_error(...) for those.
+ */
+inline thread_pool& get_default_thread_pool()
+{
+  static thread_pool pool;
+  return pool;
+}
+
+namespace detail
+{
+// the state shared by the evaluation tasks of one async_propagate_error(...) call.
+// the task that finishes last combines the deviations and fulfills the promise.
+template<typename R, typename F, typename... Args>
+struct async_propagation_state {
+  using result_type    = uncertain<R>;
+  using deviation_type = decltype(std::declval<R>() - std::declval<R>());
+  static constexpr size_t N = sizeof...(Args);
+
+  F                                async_f;
+  std::tuple<Args...>              args;
+  std::optional<R>                 nominal;
+  std::array<std::optional<R>, N>  perturbed;
+  std::atomic<size_t>              remaining{0};
+  std::mutex                       error_mutex;
+  std::exception_ptr               error;
+  std::promise<result_type>        promise;
+
+  async_propagation_state(F a_f, Args... a_args) : async_f(std::move(a_f)), args(std::move(a_args)...) {}
+
+  // evaluate the function at the nominal point (a_k == N) or with argument a_k at its upper value.
+  template<size_t... I>
+  R evaluate(size_t a_k, std::index_sequence<I...>)
+  {
+    return async_f((I == a_k ? get_upper(std::get<I>(args)) : get_nominal(std::get<I>(args)))...);
+  }
+
+  void run(size_t a_k)
+  {
+    try {
+      R val = evaluate(a_k, std::index_sequence_for<Args...>{});
+      if(a_k == N) {
+        nominal.emplace(std::move(val));
+      } else {
+        perturbed[a_k].emplace(std::move(val));
+      }
+    } catch(...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if(!error) {
+        error = std::current_exception();
+      }
+    }
+    if(remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      finish();
+    }
+  }
+
+  void finish()
+  {
+    if(error) {
+      promise.set_exception(error);
+      return;
+    }
+    try {
+      auto sum = zero<deviation_type>() * zero<deviation_type>();
+      for(size_t i = 0; i < N; ++i) {
+        if(perturbed[i]) {
+          deviation_type d = *perturbed[i] - *nominal;
+          sum += d * d;
+        }
+      }
+      promise.set_value(result_type(*nominal, sqrt(sum)));
+    } catch(...) {
+      promise.set_exception(std::current_exception());
+    }
+  }
+};
+}  // namespace detail
+
+/**
+ * Propagate error through a function f, evaluating the function at all points concurrently.
+ *
+ * The nominal point and one perturbed point for each uncertain argument are submitted to the
+ * executor as separate tasks, so the wall time for a function with a high latency (a call into
+ * another process, a remote service, ...) is about one latency instead of N+1. The result is
+ * the same as basic_error_propagator::propagate_error(f, args...). If f throws, the future
+ * holds the exception.
+ *
+ * f must be safe to call from several threads at once. The evaluations only all run at once if the
+ * executor has a thread for each of them (see get_default_thread_pool()).
+ *
+ * DOES NOT HANDLE CORRELATED INPUTS
+ */
+template<typename Executor, typename F, typename... Args>
+auto async_propagate_error(Executor& a_executor, F a_f, Args... args)
+    -> decltype(a_executor.execute(std::function<void()>{}), std::future<uncertain<decltype(a_f(get_nominal(args)...))>>())
+{
+  using R     = decltype(a_f(get_nominal(args)...));
+  using state = detail::async_propagation_state<R, F, Args...>;
+  constexpr size_t N = sizeof...(Args);
+
+  std::array<bool, N> uncertain_args{is_uncertain(args)...};
+  auto                s      = std::make_shared<state>(std::move(a_f), std::move(args)...);
+  auto                future = s->promise.get_future();
+
+  s->remaining = 1 + std::count(uncertain_args.begin(), uncertain_args.end(), true);
+  a_executor.execute([s]() { s->run(N); });
+  for(size_t i = 0; i < N; ++i) {
+    if(uncertain_args[i]) {
+      a_executor.execute([s, i]() { s->run(i); });
+    }
+  }
+  return future;
+}
+
+/**
+ * Propagate error through a function f, evaluating the function at all points concurrently on the default thread pool.
+ */
+template<typename F, typename... Args>
+auto async_propagate_error(F a_f, Args... args)
+    -> std::future<uncertain<decltype(a_f(get_nominal(args)...))>>
+{
+  return async_propagate_error(get_default_thread_pool(), std::move(a_f), std::move(args)...);
+}
+
+}  // namespace libUncertainty
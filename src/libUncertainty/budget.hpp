@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "./uncertain_core.hpp"
+#include "./utils.hpp"
+
+/** @file budget.hpp
+ * @brief The uncertainty budget (contribution of each input to the uncertainty of a result).
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+/**
+ * The result of an error propagation together with the contribution of each input.
+ *
+ * The uncertainty of the result is
+ *
+ *   u^2 = \sum_i c_i^2 + \sum_{i \ne j} t_{ij}
+ *
+ * where c_i = f(..., x_i + u_i, ...) - f(..., x_i, ...) is the contribution (deviation) of input i,
+ * and t_{ij} = \rho_{ij} c_i c_j is the correlation term for inputs i and j (t_{ii} = 0).
+ *
+ * All arrays have a fixed size, so creating a budget does not allocate.
+ */
+template<typename NT, typename DT, size_t N>
+struct uncertainty_budget {
+  using nominal_type   = NT;
+  using deviation_type = DT;
+  using variance_type  = decltype(DT() * DT());
+
+  uncertain<NT>                                  result;
+  std::array<DT, N>                              contributions;
+  // the sensitivity coefficient c_i / u_i for each input, computed with raw values (see strip_unit(...)).
+  // inputs that are not uncertain have a sensitivity of zero.
+  std::array<double, N>                          sensitivities;
+  std::array<std::array<variance_type, N>, N>    correlation_terms;
+
+  static constexpr size_t size() { return N; }
+
+  /**
+   * Return the fraction of the result's variance that is due to input i.
+   *
+   * The correlation terms are split evenly between the two inputs, so the fractions add up
+   * to one. A fraction can be negative if input i is anti-correlated with other inputs.
+   * If the result has no uncertainty, no input contributes and the fraction is zero.
+   */
+  double variance_fraction(size_t a_i) const
+  {
+    auto unc = static_cast<double>(strip_unit(result.uncertainty()));
+    if(unc == 0) {
+      return 0;
+    }
+    auto var = contributions[a_i] * contributions[a_i];
+    for(size_t j = 0; j < N; ++j) {
+      var += correlation_terms[a_i][j];
+    }
+    return static_cast<double>(strip_unit(var)) / (unc * unc);
+  }
+
+  /**
+   * Return the index of the input with the largest variance fraction.
+   */
+  size_t dominant_input() const
+  {
+    size_t k = 0;
+    for(size_t i = 1; i < N; ++i) {
+      if(variance_fraction(i) > variance_fraction(k)) {
+        k = i;
+      }
+    }
+    return k;
+  }
+};
+
+}  // namespace libUncertainty
@@ -10,6 +10,7 @@
 #include <exception>
 #include <iostream>
 #include <map>
+#include <vector>
 
 #include "./utils.hpp"
 
@@ -34,7 +35,11 @@ struct correlation_matrix {
     // in the last element of the vector
     if(a_i == a_j)
       return m_elements.size() - 1;
-    return a_i + a_j - 1;
+    // the off-diagonal elements of the upper triangle are stored column by column:
+    // (0,1), (0,2), (1,2), (0,3), (1,3), (2,3), ...
+    if(a_i > a_j)
+      std::swap(a_i, a_j);
+    return a_j * (a_j - 1) / 2 + a_i;
   }
 
  public:
@@ -52,10 +57,14 @@ struct correlation_matrix {
   {
     return m_elements[compute_index(a_i, a_j)];
   }
+  /**
+   * Return the size of the matrix (N for an NxN matrix).
+   */
+  size_t size() const { return m_elements.empty() ? 0 : compute_matrix_size(m_elements.size()); }
 
   friend std::ostream& operator<<(std::ostream& out, const correlation_matrix<T>& a_mat)
   {
-    size_t N = a_mat.compute_storage_size();
+    size_t N = a_mat.size();
     out << "(";
     for(int i = 0; i < N; ++i) {
       out << "( ";
@@ -181,10 +190,25 @@ struct correlation_store {
     return get_with_ids(get_id(a_v1), get_id(a_v2));
   }
 
+  /**
+   * Return the number of entries in the store.
+   */
+  size_t size() const { return m_correlation_coefficients.size(); }
+
+  /**
+   * Remove all entries from the store.
+   */
+  void clear() { m_correlation_coefficients.clear(); }
+
  private:
   map_type m_correlation_coefficients;
 };
 
+#ifdef LIBUNCERTAINTY_EXTERN_TEMPLATES
+extern template struct correlation_matrix<double>;
+extern template struct correlation_store<double>;
+#endif
+
 /**
  * Returns a reference to a static, global correlation store.
  */
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "./correlation.hpp"
+#include "./uncertain_core.hpp"
+#include "./utils.hpp"
+
+/** @file implicit.hpp
+ * @brief Error propagation for values that are defined implicitly, as the root of an equation.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+namespace detail
+{
+// evaluate g(y, x_0, ..., x_{N-1}) with argument a_k at its upper value (a_k == N for the nominal point).
+template<typename G, typename Y, typename Tuple, size_t... I>
+auto evaluate_implicit(G& a_g, const Y& a_y, size_t a_k, const Tuple& a_args, std::index_sequence<I...>)
+{
+  return a_g(a_y, (I == a_k ? get_upper(std::get<I>(a_args)) : get_nominal(std::get<I>(a_args)))...);
+}
+}  // namespace detail
+
+/**
+ * Propagate error to a value y that is defined implicitly by g(y, x_0, ..., x_{N-1}) = 0.
+ *
+ * Wrapping a root finder in the function passed to propagate_error(...) solves the equation
+ * N+1 times. Here, the equation is solved once, at the nominal point, by calling
+ * a_solve(x_0, ..., x_{N-1}) with the nominal values of the inputs. The sensitivities are
+ * then given by the implicit function theorem, dy/dx_i = -(dg/dx_i) / (dg/dy), and the
+ * deviations are computed with N+2 evaluations of g: the nominal point, a small step in y,
+ * and each input at its upper value.
+ *
+ * The result has the correlation coefficients between y and each input, like propagate_error_and_correlation(...).
+ *
+ * example:
+ *
+ * // y + exp(y) = x
+ * auto y = implicit_propagate([](double y, double x) { return y + exp(y) - x; },
+ *                             [](double x) { return my_root_finder(...); }, x);
+ *
+ * DOES NOT HANDLE CORRELATED INPUTS
+ */
+template<typename G, typename Solver, typename... Args>
+auto implicit_propagate(G a_g, Solver a_solve, Args... args)
+    -> add_correlation_coefficient_array<uncertain<decltype(a_solve(get_nominal(args)...))>, double>
+{
+  using value_type        = decltype(a_solve(get_nominal(args)...));
+  using residual_type     = decltype(a_g(std::declval<value_type>(), get_nominal(args)...));
+  using residual_diff     = decltype(std::declval<residual_type>() - std::declval<residual_type>());
+  using deviation_type    = decltype(std::declval<value_type>() - std::declval<value_type>());
+  constexpr size_t N      = sizeof...(Args);
+  auto             inputs = std::make_tuple(args...);
+
+  value_type    y       = a_solve(get_nominal(args)...);
+  residual_type nominal = detail::evaluate_implicit(a_g, y, N, inputs, std::index_sequence_for<Args...>{});
+
+  // dg/dy by a forward difference, with the step scaled to y
+  double         y_raw = static_cast<double>(strip_unit(y));
+  deviation_type h     = attach_unit<deviation_type>(std::sqrt(std::numeric_limits<double>::epsilon()) * std::max(std::abs(y_raw), 1.));
+  auto           g_y   = (a_g(y + h, get_nominal(args)...) - nominal) / h;
+  if(static_cast<double>(strip_unit(g_y)) == 0) {
+    throw std::runtime_error("implicit_propagate: dg/dy is zero at the solution, y is not locally defined by g(y, x...) = 0.");
+  }
+
+  std::array<deviation_type, N> deviations;
+  std::array<bool, N>           uncertain_args{is_uncertain(args)...};
+  for(size_t i = 0; i < N; ++i) {
+    if(uncertain_args[i]) {
+      residual_diff dg = detail::evaluate_implicit(a_g, y, i, inputs, std::index_sequence_for<Args...>{}) - nominal;
+      deviations[i]    = -dg / g_y;
+    } else {
+      deviations[i] = zero<deviation_type>();
+    }
+  }
+
+  auto unc = sqrt(std::inner_product(deviations.begin(), deviations.end(), deviations.begin(), zero<deviation_type>() * zero<deviation_type>()));
+  add_correlation_coefficient_array<uncertain<value_type>, double> ret(y, unc);
+  ret.set_correlation_coefficient_array_size(N);
+  for(size_t i = 0; i < N; ++i) {
+    ret.get_correlation_coefficients()[i] = deviations[i] / unc;
+  }
+  return ret;
+}
+
+}  // namespace libUncertainty
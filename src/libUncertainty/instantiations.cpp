@@ -0,0 +1,48 @@
+/** @file instantiations.cpp
+ * @brief Explicit instantiations of the commonly used templates for double.
+ *
+ * This file is compiled into the optional libUncertainty::instantiations library
+ * (-DLIBUNCERTAINTY_BUILD_INSTANTIATIONS=ON). Targets that link it get
+ * LIBUNCERTAINTY_EXTERN_TEMPLATES defined, so the headers declare these
+ * specializations `extern template` and they are not compiled again in each
+ * translation unit.
+ *
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+#include <vector>
+
+#include "./correlation.hpp"
+#include "./io.hpp"
+#include "./statistics.hpp"
+#include "./uncertain_core.hpp"
+#include "./utils.hpp"
+
+namespace libUncertainty
+{
+// utils.hpp
+template double sigfig_round<double>(double, size_t);
+template int    scientific_notation_exponent<double>(double);
+
+// statistics.hpp
+template double average<std::vector<double>::iterator>(std::vector<double>::iterator, std::vector<double>::iterator);
+template double average<std::vector<double>::const_iterator>(std::vector<double>::const_iterator, std::vector<double>::const_iterator);
+template double variance<std::vector<double>::iterator>(std::vector<double>::iterator, std::vector<double>::iterator, size_t);
+template double variance<std::vector<double>::const_iterator>(std::vector<double>::const_iterator, std::vector<double>::const_iterator, size_t);
+template double standard_deviation<std::vector<double>::iterator>(std::vector<double>::iterator, std::vector<double>::iterator, size_t);
+template double standard_deviation<std::vector<double>::const_iterator>(std::vector<double>::const_iterator, std::vector<double>::const_iterator, size_t);
+template double standard_error_of_the_mean<std::vector<double>::iterator>(std::vector<double>::iterator, std::vector<double>::iterator);
+template double standard_error_of_the_mean<std::vector<double>::const_iterator>(std::vector<double>::const_iterator, std::vector<double>::const_iterator);
+
+// uncertain_core.hpp (including normalize())
+template class uncertain<double>;
+
+// io.hpp
+template std::ostream& operator<<(std::ostream&, const uncertain<double, double>&);
+template std::istream& operator>>(std::istream&, uncertain<double, double>&);
+
+// correlation.hpp
+template struct correlation_matrix<double>;
+template struct correlation_store<double>;
+}  // namespace libUncertainty
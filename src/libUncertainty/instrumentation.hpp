@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "./propagate_core.hpp"
+
+/** @file instrumentation.hpp
+ * @brief Instrumentation policies for the error propagators.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+/**
+ * A histogram of latencies with logarithmic (powers of two nanoseconds) buckets.
+ */
+struct latency_histogram {
+  // bucket k counts latencies in [2^k, 2^(k+1)) ns. bucket 0 also counts latencies less than 1 ns.
+  std::array<size_t, 64> buckets{};
+  size_t                 count    = 0;
+  double                 total_ns = 0;
+  double                 min_ns   = std::numeric_limits<double>::infinity();
+  double                 max_ns   = 0;
+
+  void add(double a_ns)
+  {
+    size_t k = 0;
+    while(k < buckets.size() - 1 && a_ns >= static_cast<double>(2ul << k)) {
+      ++k;
+    }
+    ++buckets[k];
+    ++count;
+    total_ns += a_ns;
+    min_ns = std::min(min_ns, a_ns);
+    max_ns = std::max(max_ns, a_ns);
+  }
+
+  void merge(const latency_histogram& a_other)
+  {
+    for(size_t k = 0; k < buckets.size(); ++k) {
+      buckets[k] += a_other.buckets[k];
+    }
+    count += a_other.count;
+    total_ns += a_other.total_ns;
+    min_ns = std::min(min_ns, a_other.min_ns);
+    max_ns = std::max(max_ns, a_other.max_ns);
+  }
+
+  double mean() const { return count > 0 ? total_ns / count : 0; }
+
+  /**
+   * Return an upper bound for the p'th percentile (0 <= p <= 1), i.e. the upper edge of the
+   * bucket containing it.
+   */
+  double percentile(double a_p) const
+  {
+    size_t target = static_cast<size_t>(a_p * count + 0.5), seen = 0;
+    for(size_t k = 0; k < buckets.size(); ++k) {
+      seen += buckets[k];
+      if(seen >= target && seen > 0) {
+        return std::min(max_ns, static_cast<double>(2ul << k));
+      }
+    }
+    return max_ns;
+  }
+};
+
+/**
+ * Counters collected for one call site (error propagation overload and function type).
+ */
+struct call_site_stats {
+  size_t                           calls                = 0;
+  size_t                           function_evaluations = 0;
+  size_t                           allocations          = 0;
+  latency_histogram                latency;  // whole call
+  std::array<latency_histogram, 3> stage_latency;
+
+  const latency_histogram& get_stage_latency(propagation_stage a_stage) const { return stage_latency[static_cast<size_t>(a_stage)]; }
+
+  void merge(const call_site_stats& a_other)
+  {
+    calls += a_other.calls;
+    function_evaluations += a_other.function_evaluations;
+    allocations += a_other.allocations;
+    latency.merge(a_other.latency);
+    for(size_t i = 0; i < stage_latency.size(); ++i) {
+      stage_latency[i].merge(a_other.stage_latency[i]);
+    }
+  }
+};
+
+/**
+ * A thread-safe collection of call site stats.
+ */
+class instrumentation_registry
+{
+ public:
+  using key_type = std::pair<std::string, std::type_index>;
+
+  void record(const key_type& a_key, const call_site_stats& a_stats)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.try_emplace(a_key).first->second.merge(a_stats);
+  }
+
+  /**
+   * Get the stats for calls to the given propagate_error overload with a function.
+   */
+  template<typename F>
+  call_site_stats get(const std::string& a_overload, const F&) const
+  {
+    return get({a_overload, std::type_index(typeid(F))});
+  }
+
+  call_site_stats get(const key_type& a_key) const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto                        it = m_stats.find(a_key);
+    return it == m_stats.end() ? call_site_stats{} : it->second;
+  }
+
+  /**
+   * Get a list of all call sites that have been recorded.
+   */
+  std::vector<key_type> sites() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<key_type>       keys;
+    for(const auto& entry : m_stats) {
+      keys.push_back(entry.first);
+    }
+    return keys;
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.clear();
+  }
+
+ private:
+  mutable std::mutex                 m_mutex;
+  std::map<key_type, call_site_stats> m_stats;
+};
+
+/**
+ * An instrumentation policy that counts function evaluations and allocations, and records
+ * latency histograms for each call site in a global registry.
+ */
+struct counting_instrumentation {
+  static instrumentation_registry& registry()
+  {
+    static instrumentation_registry r;
+    return r;
+  }
+
+  // the trace hooks are inherited from no_instrumentation::recorder and do nothing.
+  class recorder : public no_instrumentation::recorder
+  {
+   public:
+    using clock = std::chrono::steady_clock;
+
+    template<typename F>
+    recorder(const char* a_overload, const F& a_f)
+        : no_instrumentation::recorder(a_overload, a_f), m_key(a_overload, std::type_index(typeid(F))), m_start(clock::now())
+    {
+      m_stats.calls = 1;
+    }
+    ~recorder()
+    {
+      m_stats.latency.add(std::chrono::duration<double, std::nano>(clock::now() - m_start).count());
+      registry().record(m_key, m_stats);
+    }
+    recorder(const recorder&) = delete;
+    recorder& operator=(const recorder&) = delete;
+
+    template<typename F>
+    auto wrap(F& a_f)
+    {
+      return [this, &a_f](auto&&... args) -> decltype(a_f(std::forward<decltype(args)>(args)...)) {
+        ++m_stats.function_evaluations;
+        return a_f(std::forward<decltype(args)>(args)...);
+      };
+    }
+    void start(propagation_stage a_stage) { m_stage_start[static_cast<size_t>(a_stage)] = clock::now(); }
+    void stop(propagation_stage a_stage)
+    {
+      auto i = static_cast<size_t>(a_stage);
+      m_stats.stage_latency[i].add(std::chrono::duration<double, std::nano>(clock::now() - m_stage_start[i]).count());
+    }
+    void add_allocations(size_t a_n) { m_stats.allocations += a_n; }
+
+   private:
+    instrumentation_registry::key_type m_key;
+    clock::time_point                  m_start;
+    std::array<clock::time_point, 3>   m_stage_start;
+    call_site_stats                    m_stats;
+  };
+};
+
+}  // namespace libUncertainty
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include "./uncertain_core.hpp"
+
+/** @file io.hpp
+ * @brief Stream operators for the uncertain class.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+template<typename T, typename>
+auto sigfig_round(T t, size_t n) -> decltype(std::declval<std::istream&>() >> t, std::declval<std::ostream&>() << t, T())
+{
+  std::stringstream ss;
+  ss.precision(n == 0 ? 0 : n - 1);
+  ss.setf(std::ios_base::scientific, std::ios_base::floatfield);
+  ss << t;
+  ss >> t;
+  return t;
+}
+
+template<typename NT, typename UT>
+std::ostream& operator<<(std::ostream& out, const uncertain<NT, UT>& a_val)
+{
+  out << a_val.nominal() << " +/- " << a_val.uncertainty();
+  return out;
+}
+
+template<typename NT, typename UT>
+std::istream& operator>>(std::istream& in, uncertain<NT, UT>& a_val)
+{
+  std::string tmp;
+  NT          nom;
+  UT          unc;
+  in >> nom >> tmp >> unc;
+  a_val.nominal(nom);
+  a_val.uncertainty(unc);
+  return in;
+}
+
+
+#ifdef LIBUNCERTAINTY_EXTERN_TEMPLATES
+extern template std::ostream& operator<<(std::ostream&, const uncertain<double, double>&);
+extern template std::istream& operator>>(std::istream&, uncertain<double, double>&);
+#endif
+
+}  // namespace libUncertainty
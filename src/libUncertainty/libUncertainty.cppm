@@ -0,0 +1,165 @@
+/** @file libUncertainty.cppm
+ * @brief C++20 module interface for libUncertainty.
+ *
+ * The module wraps the headers, so the header-only library is still the single
+ * source of truth. Build it with -DLIBUNCERTAINTY_BUILD_MODULE=ON and link against
+ * libUncertainty::module, then
+ *
+ *   import libUncertainty;
+ *
+ * The module is experimental. testing/module_smoke.cpp imports it to check the exports.
+ *
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+module;
+
+#include "./archive.hpp"
+#include "./async.hpp"
+#include "./budget.hpp"
+#include "./correlation.hpp"
+#include "./instrumentation.hpp"
+#include "./io.hpp"
+#include "./implicit.hpp"
+#include "./linear_fit.hpp"
+#include "./matrix.hpp"
+#include "./memo_cache.hpp"
+#include "./nonlinear_fit.hpp"
+#include "./ode.hpp"
+#include "./persistent_cache.hpp"
+#include "./polynomial.hpp"
+#include "./series.hpp"
+#include "./propagate.hpp"
+#include "./statistics.hpp"
+#include "./tags.hpp"
+#include "./tracing.hpp"
+#include "./uncertain.hpp"
+#include "./utils.hpp"
+
+export module libUncertainty;
+
+export namespace libUncertainty
+{
+// uncertain.hpp, io.hpp
+using libUncertainty::make_uncertain;
+using libUncertainty::uncertain;
+using libUncertainty::operator<<;
+using libUncertainty::operator>>;
+
+// utils.hpp
+using libUncertainty::add_id;
+using libUncertainty::attach_unit;
+using libUncertainty::get_id;
+using libUncertainty::get_lower;
+using libUncertainty::get_nominal;
+using libUncertainty::get_uncertainty;
+using libUncertainty::get_uniq_id;
+using libUncertainty::get_upper;
+using libUncertainty::hash_values;
+using libUncertainty::is_uncertain;
+using libUncertainty::priority;
+using libUncertainty::scientific_notation_exponent;
+using libUncertainty::sigfig_round;
+using libUncertainty::strip_unit;
+using libUncertainty::zero;
+
+// statistics.hpp
+using libUncertainty::average;
+using libUncertainty::standard_deviation;
+using libUncertainty::standard_error_of_the_mean;
+using libUncertainty::variance;
+using libUncertainty::z_score;
+
+// propagate.hpp
+using libUncertainty::basic_error_propagator;
+using libUncertainty::instrumented_error_propagator;
+using libUncertainty::no_instrumentation;
+using libUncertainty::propagation_stage;
+using libUncertainty::uncertainty_budget;
+
+// async.hpp
+using libUncertainty::async_propagate_error;
+using libUncertainty::get_default_thread_pool;
+using libUncertainty::thread_pool;
+
+// correlation.hpp
+using libUncertainty::add_correlation_coefficient_array;
+using libUncertainty::correlation_matrix;
+using libUncertainty::correlation_store;
+using libUncertainty::get_global_correlation_store;
+
+// instrumentation.hpp
+using libUncertainty::call_site_stats;
+using libUncertainty::counting_instrumentation;
+using libUncertainty::instrumentation_registry;
+using libUncertainty::latency_histogram;
+
+// tracing.hpp
+using libUncertainty::ring_buffer_tracer;
+using libUncertainty::to_string;
+using libUncertainty::trace_event;
+using libUncertainty::trace_event_kind;
+using libUncertainty::tracing_instrumentation;
+
+// archive.hpp
+using libUncertainty::archive_options;
+using libUncertainty::decode_uncertain_column;
+using libUncertainty::encode_uncertain_column;
+
+// implicit.hpp
+using libUncertainty::implicit_propagate;
+
+// linear_fit.hpp
+using libUncertainty::generalized_linear_fit;
+using libUncertainty::linear_fit;
+using libUncertainty::linear_fit_result;
+using libUncertainty::linear_least_squares_accumulator;
+using libUncertainty::polynomial_basis;
+using libUncertainty::straight_line_basis;
+
+// matrix.hpp
+using libUncertainty::uncertain_matrix;
+using libUncertainty::operator*;
+
+// memo_cache.hpp
+using libUncertainty::memo_cache;
+using libUncertainty::memoize;
+using libUncertainty::memoized_function;
+
+// nonlinear_fit.hpp
+using libUncertainty::levenberg_marquardt_options;
+using libUncertainty::nonlinear_fit;
+using libUncertainty::nonlinear_fit_result;
+
+// ode.hpp
+using libUncertainty::ode_method;
+using libUncertainty::ode_options;
+using libUncertainty::ode_propagate;
+using libUncertainty::ode_propagate_trajectory;
+using libUncertainty::ode_sensitivity_result;
+
+// persistent_cache.hpp
+using libUncertainty::memoize_persistent;
+using libUncertainty::persistent_cache;
+using libUncertainty::persistent_memoized_function;
+
+// polynomial.hpp
+using libUncertainty::evaluate_polynomial;
+using libUncertainty::uncertain_polynomial;
+
+// series.hpp
+using libUncertainty::banded_covariance;
+using libUncertainty::central_difference;
+using libUncertainty::cumulative_covariance;
+using libUncertainty::cumulative_sum;
+using libUncertainty::cumulative_trapezoid;
+using libUncertainty::forward_difference;
+using libUncertainty::simpson;
+using libUncertainty::trapezoid;
+}  // namespace libUncertainty
+
+export namespace libUncertainty::tags
+{
+using libUncertainty::tags::strip_units;
+using libUncertainty::tags::use_stdev_for_error;
+}  // namespace libUncertainty::tags
@@ -0,0 +1,442 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "./correlation.hpp"
+#include "./uncertain_core.hpp"
+#include "./utils.hpp"
+
+/** @file linear_fit.hpp
+ * @brief Linear least-squares fitting of uncertain data, with the parameter covariance.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+namespace detail
+{
+// in-place Cholesky decomposition of a symmetric positive definite, row-major NxN matrix.
+// the lower triangle is replaced with L (A = L L^T). returns false if A is not positive definite.
+inline bool cholesky_decompose(double* a_A, size_t a_N)
+{
+  for(size_t j = 0; j < a_N; ++j) {
+    double d = a_A[j * a_N + j];
+    for(size_t k = 0; k < j; ++k) {
+      d -= a_A[j * a_N + k] * a_A[j * a_N + k];
+    }
+    if(!(d > 0)) {
+      return false;
+    }
+    d                  = std::sqrt(d);
+    a_A[j * a_N + j]   = d;
+    for(size_t i = j + 1; i < a_N; ++i) {
+      double s = a_A[i * a_N + j];
+      for(size_t k = 0; k < j; ++k) {
+        s -= a_A[i * a_N + k] * a_A[j * a_N + k];
+      }
+      a_A[i * a_N + j] = s / d;
+    }
+  }
+  return true;
+}
+
+// solve L x = b in place (forward substitution) with the factor from cholesky_decompose.
+inline void cholesky_forward(const double* a_L, size_t a_N, double* a_b)
+{
+  for(size_t i = 0; i < a_N; ++i) {
+    double s = a_b[i];
+    for(size_t k = 0; k < i; ++k) {
+      s -= a_L[i * a_N + k] * a_b[k];
+    }
+    a_b[i] = s / a_L[i * a_N + i];
+  }
+}
+
+// solve L^T x = b in place (back substitution) with the factor from cholesky_decompose.
+inline void cholesky_backward(const double* a_L, size_t a_N, double* a_b)
+{
+  for(size_t i = a_N; i-- > 0;) {
+    double s = a_b[i];
+    for(size_t k = i + 1; k < a_N; ++k) {
+      s -= a_L[k * a_N + i] * a_b[k];
+    }
+    a_b[i] = s / a_L[i * a_N + i];
+  }
+}
+}  // namespace detail
+
+/**
+ * The basis functions for a straight line, y = p_0 + p_1 x.
+ */
+struct straight_line_basis {
+  std::array<double, 2> operator()(double a_x) const { return {1, a_x}; }
+};
+
+/**
+ * The basis functions for a polynomial, y = p_0 + p_1 x + ... + p_D x^D.
+ */
+template<size_t D>
+struct polynomial_basis {
+  std::array<double, D + 1> operator()(double a_x) const
+  {
+    std::array<double, D + 1> ret;
+    ret[0] = 1;
+    for(size_t k = 1; k <= D; ++k) {
+      ret[k] = ret[k - 1] * a_x;
+    }
+    return ret;
+  }
+};
+
+/**
+ * The result of a linear least-squares fit with M parameters.
+ */
+template<size_t M>
+struct linear_fit_result {
+  std::array<uncertain<double>, M>      parameters;
+  // the correlation between the parameters, pass it to propagate_error(...) with the parameters
+  // to get the uncertainty of a quantity computed from the fit.
+  correlation_matrix<double>            correlation;
+  std::array<std::array<double, M>, M> covariance;
+  double                                chi2 = 0;
+  size_t                                dof  = 0;
+  // the upper triangular factor R of the (weighted) design matrix, covariance = covariance_scale * (R^T R)^-1
+  std::array<std::array<double, M>, M> factor{};
+  double                                covariance_scale = 1;
+
+  double reduced_chi2() const { return dof > 0 ? chi2 / dof : 0; }
+
+  /**
+   * Return the uncertainty of the fitted function at a point, sqrt(b^T C b) for the basis function values b.
+   *
+   * This is computed from the factor, as sqrt(covariance_scale) |R^-T b|. For an ill-conditioned basis (e.g. a
+   * polynomial of x far from zero) the covariance elements are nearly cancelling, and b^T C b loses most of its digits.
+   */
+  double prediction_uncertainty(const std::array<double, M>& a_basis) const
+  {
+    std::array<double, M> u;
+    double                sum = 0;
+    for(size_t i = 0; i < M; ++i) {
+      double s = a_basis[i];
+      for(size_t k = 0; k < i; ++k) {
+        s -= factor[k][i] * u[k];
+      }
+      u[i] = s / factor[i][i];
+      sum += u[i] * u[i];
+    }
+    return std::sqrt(covariance_scale * sum);
+  }
+};
+
+/**
+ * Accumulates a linear least-squares problem with M parameters.
+ *
+ * Each point is added in constant time and memory, so a fit can be done in one pass over a data set of
+ * any size. The accumulator stores the (M+1)x(M+1) triangular factor R of the QR decomposition of the
+ * weighted design matrix with the measured values appended as the last column, and each point is
+ * rotated into it with Givens rotations. This avoids forming the normal equations A^T W A, which
+ * square the condition number of the problem (e.g. polynomials of x far from zero) and lose chi^2 to
+ * cancellation. Accumulators filled on different threads can be merged.
+ */
+template<size_t M>
+class linear_least_squares_accumulator
+{
+ public:
+  /**
+   * Add a point with the basis function values a_basis (the row of the design matrix), the measured
+   * value a_y, and the weight a_weight (1/sigma^2 for a weighted fit).
+   */
+  void add(const std::array<double, M>& a_basis, double a_y, double a_weight = 1)
+  {
+    double                    w = std::sqrt(a_weight);
+    std::array<double, M + 1> row;
+    for(size_t i = 0; i < M; ++i) {
+      row[i] = w * a_basis[i];
+    }
+    row[M] = w * a_y;
+    rotate_in(row);
+    ++m_count;
+  }
+
+  /**
+   * Add the points accumulated by another accumulator.
+   *
+   * The rows of the other factor are rotated in, which gives the factor of all points together.
+   */
+  void merge(const linear_least_squares_accumulator& a_other)
+  {
+    for(size_t k = 0; k <= M; ++k) {
+      rotate_in(a_other.m_R[k]);
+    }
+    m_count += a_other.m_count;
+  }
+
+  size_t count() const { return m_count; }
+
+  /**
+   * Return element (i,j) of the normal matrix A^T W A.
+   */
+  double normal(size_t a_i, size_t a_j) const { return column_product(a_i, a_j); }
+  /**
+   * Return element i of the right hand side A^T W y.
+   */
+  double rhs(size_t a_i) const { return column_product(a_i, M); }
+  /**
+   * Return y^T W y, the weighted sum of squares of the measured values.
+   */
+  double weighted_sum_of_squares() const { return column_product(M, M); }
+
+  /**
+   * Solve the least-squares problem.
+   *
+   * For a weighted fit, the parameter covariance is the inverse of the normal matrix. For an
+   * unweighted fit (or if the weights are only relative), pass a_scale_covariance = true to
+   * scale the covariance by the reduced chi^2, i.e. estimate the measurement variance from the residuals.
+   * This needs more points than parameters, std::invalid_argument is thrown otherwise.
+   */
+  linear_fit_result<M> solve(bool a_scale_covariance = false) const
+  {
+    if(m_count < M) {
+      throw std::invalid_argument("linear least-squares fit needs at least as many points as parameters.");
+    }
+    if(a_scale_covariance && m_count == M) {
+      throw std::invalid_argument("linear least-squares fit needs more points than parameters to estimate the covariance from the residuals.");
+    }
+    // a column that is (nearly) a combination of the previous ones leaves a diagonal element
+    // that is only rounding error compared to the norm of the column.
+    for(size_t i = 0; i < M; ++i) {
+      if(!(m_R[i][i] > 16 * M * std::numeric_limits<double>::epsilon() * std::sqrt(column_product(i, i)))) {
+        throw std::runtime_error("linear least-squares problem is singular, the basis functions are not independent for the given points.");
+      }
+    }
+
+    // R p = z, where z is the last column of the factor
+    linear_fit_result<M> result;
+    std::array<double, M> p;
+    for(size_t i = M; i-- > 0;) {
+      double s = m_R[i][M];
+      for(size_t k = i + 1; k < M; ++k) {
+        s -= m_R[i][k] * p[k];
+      }
+      p[i] = s / m_R[i][i];
+    }
+    result.chi2 = m_R[M][M] * m_R[M][M];
+    result.dof  = m_count - M;
+
+    // covariance = (R^T R)^-1 = R^-1 R^-T. Rinv is upper triangular.
+    std::array<std::array<double, M>, M> Rinv{};
+    for(size_t j = 0; j < M; ++j) {
+      Rinv[j][j] = 1 / m_R[j][j];
+      for(size_t i = j; i-- > 0;) {
+        double s = 0;
+        for(size_t k = i + 1; k <= j; ++k) {
+          s += m_R[i][k] * Rinv[k][j];
+        }
+        Rinv[i][j] = -s / m_R[i][i];
+      }
+    }
+    double scale = a_scale_covariance ? result.reduced_chi2() : 1;
+    for(size_t i = 0; i < M; ++i) {
+      for(size_t j = 0; j < M; ++j) {
+        result.factor[i][j] = m_R[i][j];
+      }
+    }
+    result.covariance_scale = scale;
+    for(size_t i = 0; i < M; ++i) {
+      for(size_t j = i; j < M; ++j) {
+        double s = 0;
+        for(size_t k = j; k < M; ++k) {
+          s += Rinv[i][k] * Rinv[j][k];
+        }
+        result.covariance[i][j] = result.covariance[j][i] = scale * s;
+      }
+    }
+
+    result.correlation = correlation_matrix<double>(M);
+    for(size_t i = 0; i < M; ++i) {
+      result.parameters[i] = uncertain<double>(p[i], std::sqrt(result.covariance[i][i]));
+      for(size_t j = i + 1; j < M; ++j) {
+        // a perfect fit with a_scale_covariance has no uncertainty, and no correlation
+        double norm              = std::sqrt(result.covariance[i][i] * result.covariance[j][j]);
+        result.correlation(i, j) = norm > 0 ? result.covariance[i][j] / norm : 0;
+      }
+    }
+    return result;
+  }
+
+ private:
+  // apply the Givens rotations that zero a_row against the rows of R.
+  void rotate_in(std::array<double, M + 1> a_row)
+  {
+    for(size_t i = 0; i <= M; ++i) {
+      if(a_row[i] == 0) {
+        continue;
+      }
+      double r = std::hypot(m_R[i][i], a_row[i]);
+      double c = m_R[i][i] / r;
+      double s = a_row[i] / r;
+      m_R[i][i] = r;
+      for(size_t j = i + 1; j <= M; ++j) {
+        double t = c * m_R[i][j] + s * a_row[j];
+        a_row[j] = c * a_row[j] - s * m_R[i][j];
+        m_R[i][j] = t;
+      }
+    }
+  }
+
+  // the dot product of columns i and j of the factor, which equals the dot product of
+  // the columns of the weighted design matrix (with y as column M).
+  double column_product(size_t a_i, size_t a_j) const
+  {
+    double s = 0;
+    for(size_t k = 0; k <= std::min(a_i, a_j); ++k) {
+      s += m_R[k][a_i] * m_R[k][a_j];
+    }
+    return s;
+  }
+
+  std::array<std::array<double, M + 1>, M + 1> m_R{};  // upper triangular factor of [sqrt(W) A, sqrt(W) y]
+  size_t                                       m_count = 0;
+};
+
+/**
+ * Fit a linear combination of basis functions to a set of (x,y) points.
+ *
+ * x and y may be uncertain or plain numbers. If y has uncertainties, the fit is weighted
+ * by 1/sigma_y^2 and the parameter covariance follows from the uncertainties. Otherwise, the fit is
+ * unweighted and the covariance is estimated from the residuals (this needs more points than parameters).
+ * Whether the fit is weighted is decided by the first point, and an exception is thrown if some
+ * points have uncertainties in y and others do not.
+ *
+ * The data is read once. If x has uncertainties, they are included with the effective variance method,
+ * sigma^2 = sigma_y^2 + (f(x + sigma_x) - f(x))^2, where f is the result of the first fit that ignores
+ * them, so the data is read a second time (and the iterators must allow that). Uncertainties in x
+ * need uncertainties in y, an exception is thrown for an unweighted fit with uncertain x.
+ *
+ * To fit data that can only be read once (or does not fit in memory), add the points to a
+ * linear_least_squares_accumulator instead.
+ *
+ * @param a_basis a function that returns the values of the M basis functions at x in a std::array<double,M>.
+ */
+template<typename Basis, typename XIterator, typename YIterator>
+auto linear_fit(Basis a_basis, XIterator a_x_begin, XIterator a_x_end, YIterator a_y_begin)
+    -> linear_fit_result<std::tuple_size<decltype(a_basis(double()))>::value>
+{
+  constexpr size_t M = std::tuple_size<decltype(a_basis(double()))>::value;
+
+  // the first pass fits without the x uncertainties
+  linear_least_squares_accumulator<M> acc;
+  bool                                weighted = false, x_uncertain = false;
+  {
+    auto y = a_y_begin;
+    for(auto x = a_x_begin; x != a_x_end; ++x, ++y) {
+      double var = double(get_uncertainty(*y) * get_uncertainty(*y));
+      if(acc.count() == 0) {
+        weighted = var > 0;
+      } else if((var > 0) != weighted) {
+        throw std::invalid_argument("linear_fit: some y values have uncertainties and some do not.");
+      }
+      x_uncertain = x_uncertain || get_uncertainty(*x) != 0;
+      acc.add(a_basis(get_nominal(*x)), get_nominal(*y), weighted ? 1 / var : 1.);
+    }
+  }
+  if(x_uncertain && !weighted) {
+    throw std::invalid_argument("linear_fit: x values with uncertainties need y values with uncertainties.");
+  }
+  auto result = acc.solve(!weighted);
+  if(!x_uncertain) {
+    return result;
+  }
+
+  // the second pass adds the effective variance from the x uncertainties
+  auto model = [&](double x) {
+    auto   b   = a_basis(x);
+    double sum = 0;
+    for(size_t k = 0; k < M; ++k) {
+      sum += result.parameters[k].nominal() * b[k];
+    }
+    return sum;
+  };
+  linear_least_squares_accumulator<M> effective;
+  auto                                y = a_y_begin;
+  for(auto x = a_x_begin; x != a_x_end; ++x, ++y) {
+    double dy = model(get_nominal(*x) + get_uncertainty(*x)) - model(get_nominal(*x));
+    effective.add(a_basis(get_nominal(*x)), get_nominal(*y), 1 / (double(get_uncertainty(*y) * get_uncertainty(*y)) + dy * dy));
+  }
+  return effective.solve();
+}
+
+/**
+ * Fit a straight line y = p_0 + p_1 x to a set of (x,y) points. See linear_fit(basis, ...).
+ */
+template<typename XIterator, typename YIterator>
+linear_fit_result<2> linear_fit(XIterator a_x_begin, XIterator a_x_end, YIterator a_y_begin)
+{
+  return linear_fit(straight_line_basis{}, a_x_begin, a_x_end, a_y_begin);
+}
+
+/**
+ * Fit a linear combination of basis functions to a set of (x,y) points with correlated y values
+ * (generalized least squares).
+ *
+ * The covariance of the y values is built from their uncertainties and the correlation matrix. The
+ * problem is whitened with the Cholesky factor of this covariance, which takes O(n^3) time and
+ * O(n^2) memory for n points, so this is meant for small data sets.
+ */
+template<typename Basis, typename XIterator, typename YIterator>
+auto generalized_linear_fit(Basis a_basis, XIterator a_x_begin, XIterator a_x_end, YIterator a_y_begin, const correlation_matrix<double>& a_y_correlation)
+    -> linear_fit_result<std::tuple_size<decltype(a_basis(double()))>::value>
+{
+  constexpr size_t M = std::tuple_size<decltype(a_basis(double()))>::value;
+  size_t           n = std::distance(a_x_begin, a_x_end);
+  if(a_y_correlation.size() != n) {
+    throw std::invalid_argument("generalized_linear_fit: the correlation matrix size does not match the number of points.");
+  }
+
+  std::vector<double> V(n * n), A(n * M), y(n), sigma(n);
+  {
+    size_t i  = 0;
+    auto   yi = a_y_begin;
+    for(auto x = a_x_begin; x != a_x_end; ++x, ++yi, ++i) {
+      sigma[i] = get_uncertainty(*yi);
+      y[i]     = get_nominal(*yi);
+      auto b   = a_basis(get_nominal(*x));
+      for(size_t k = 0; k < M; ++k) {
+        A[k * n + i] = b[k];  // stored by column so each column can be whitened in place
+      }
+    }
+  }
+  for(size_t i = 0; i < n; ++i) {
+    for(size_t j = 0; j < n; ++j) {
+      V[i * n + j] = a_y_correlation(i, j) * sigma[i] * sigma[j];
+    }
+  }
+  if(!detail::cholesky_decompose(V.data(), n)) {
+    throw std::invalid_argument("generalized_linear_fit: the covariance of the y values is not positive definite.");
+  }
+  detail::cholesky_forward(V.data(), n, y.data());
+  for(size_t k = 0; k < M; ++k) {
+    detail::cholesky_forward(V.data(), n, A.data() + k * n);
+  }
+
+  linear_least_squares_accumulator<M> acc;
+  std::array<double, M>               row;
+  for(size_t i = 0; i < n; ++i) {
+    for(size_t k = 0; k < M; ++k) {
+      row[k] = A[k * n + i];
+    }
+    acc.add(row, y[i]);
+  }
+  return acc.solve();
+}
+
+}  // namespace libUncertainty
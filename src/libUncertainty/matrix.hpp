@@ -0,0 +1,309 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "./uncertain_core.hpp"
+
+/** @file matrix.hpp
+ * @brief Matrices of uncertain values: multiply, solve and invert with first-order error propagation.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+/**
+ * A dense matrix of uncertain<double> values.
+ *
+ * The nominal values and the uncertainties are stored in two separate (row-major) arrays, so
+ * the kernels that propagate error through matrix operations work on plain double matrices.
+ */
+class uncertain_matrix
+{
+ public:
+  uncertain_matrix() = default;
+  uncertain_matrix(size_t a_rows, size_t a_cols) : m_rows(a_rows), m_cols(a_cols), m_nominal(a_rows * a_cols, 0.), m_uncertainty(a_rows * a_cols, 0.) {}
+  /**
+   * Create a matrix from a list of elements, in row-major order.
+   */
+  uncertain_matrix(size_t a_rows, size_t a_cols, std::initializer_list<uncertain<double>> a_elements) : uncertain_matrix(a_rows, a_cols)
+  {
+    if(a_elements.size() != a_rows * a_cols) {
+      throw std::invalid_argument("uncertain_matrix: the number of elements does not match the size.");
+    }
+    size_t k = 0;
+    for(const auto& e : a_elements) {
+      m_nominal[k]     = e.nominal();
+      m_uncertainty[k] = e.uncertainty();
+      ++k;
+    }
+  }
+
+  size_t rows() const { return m_rows; }
+  size_t cols() const { return m_cols; }
+
+  uncertain<double> operator()(size_t a_i, size_t a_j) const { return uncertain<double>(nominal(a_i, a_j), uncertainty(a_i, a_j)); }
+  void              set(size_t a_i, size_t a_j, const uncertain<double>& a_val)
+  {
+    nominal(a_i, a_j)     = a_val.nominal();
+    uncertainty(a_i, a_j) = a_val.uncertainty();
+  }
+
+  double  nominal(size_t a_i, size_t a_j) const { return m_nominal[a_i * m_cols + a_j]; }
+  double& nominal(size_t a_i, size_t a_j) { return m_nominal[a_i * m_cols + a_j]; }
+  double  uncertainty(size_t a_i, size_t a_j) const { return m_uncertainty[a_i * m_cols + a_j]; }
+  double& uncertainty(size_t a_i, size_t a_j) { return m_uncertainty[a_i * m_cols + a_j]; }
+
+  // the nominal values and uncertainties, row-major
+  const std::vector<double>& nominal() const { return m_nominal; }
+  std::vector<double>&       nominal() { return m_nominal; }
+  const std::vector<double>& uncertainty() const { return m_uncertainty; }
+  std::vector<double>&       uncertainty() { return m_uncertainty; }
+
+  /**
+   * Multiply by another uncertain matrix, C = A B.
+   *
+   * The uncertainty is propagated to first order assuming that all elements are independent,
+   * var(C) = (A o A)(sB o sB) + (sA o sA)(B o B), where o is the element-wise product. This is
+   * three matrix multiplications, done with a blocked kernel on a_threads threads.
+   */
+  uncertain_matrix multiply(const uncertain_matrix& a_B, size_t a_threads = 1) const;
+
+  /**
+   * Solve A X = B for X.
+   *
+   * The matrix is factored once. X is computed from the factorization, and the uncertainty is propagated
+   * to first order assuming that all elements of A and B are independent, with dX = A^-1 (dB - dA X), so
+   * var(X) = (A^-1 o A^-1) [ sB o sB + (sA o sA)(X o X) ].
+   *
+   * Propagating error through a solve with propagate_error(...) would take one solve for each element of A and B.
+   */
+  uncertain_matrix solve(const uncertain_matrix& a_B, size_t a_threads = 1) const;
+
+  /**
+   * Return the inverse.
+   *
+   * The matrix is factored once. The uncertainty is propagated to first order assuming that all
+   * elements are independent, with dX = -A^-1 dA A^-1, so var(X) = (A^-1 o A^-1)(sA o sA)(A^-1 o A^-1).
+   */
+  uncertain_matrix inverse(size_t a_threads = 1) const;
+
+ private:
+  size_t              m_rows = 0;
+  size_t              m_cols = 0;
+  std::vector<double> m_nominal;
+  std::vector<double> m_uncertainty;
+};
+
+namespace detail
+{
+// run a_func(begin, end) over [0, a_n) split into contiguous chunks on a_threads threads.
+template<typename Func>
+void parallel_for(size_t a_n, size_t a_threads, Func a_func)
+{
+  size_t                   chunks = std::max<size_t>(1, std::min(a_threads, a_n));
+  std::vector<std::thread> workers;
+  for(size_t t = 1; t < chunks; ++t) {
+    workers.emplace_back([&, t]() { a_func(a_n * t / chunks, a_n * (t + 1) / chunks); });
+  }
+  a_func(0, a_n / chunks);
+  for(auto& w : workers) {
+    w.join();
+  }
+}
+
+// C (n x p) = A (n x m) * B (m x p), all row-major. the loops are blocked so that a block of B
+// stays in cache while it is used, and the rows of C are split across threads.
+inline void matrix_multiply(const double* a_A, const double* a_B, double* a_C, size_t a_n, size_t a_m, size_t a_p, size_t a_threads = 1)
+{
+  constexpr size_t block = 64;
+  std::fill(a_C, a_C + a_n * a_p, 0.);
+  parallel_for(a_n, a_threads, [&](size_t a_begin, size_t a_end) {
+    for(size_t kk = 0; kk < a_m; kk += block) {
+      size_t k_end = std::min(kk + block, a_m);
+      for(size_t jj = 0; jj < a_p; jj += block) {
+        size_t j_end = std::min(jj + block, a_p);
+        for(size_t i = a_begin; i < a_end; ++i) {
+          double* c = a_C + i * a_p;
+          for(size_t k = kk; k < k_end; ++k) {
+            double        aik = a_A[i * a_m + k];
+            const double* b   = a_B + k * a_p;
+            for(size_t j = jj; j < j_end; ++j) {
+              c[j] += aik * b[j];
+            }
+          }
+        }
+      }
+    }
+  });
+}
+
+inline std::vector<double> squared(const std::vector<double>& a_v)
+{
+  std::vector<double> s(a_v.size());
+  for(size_t i = 0; i < a_v.size(); ++i) {
+    s[i] = a_v[i] * a_v[i];
+  }
+  return s;
+}
+
+// LU decomposition with partial pivoting, in place (row-major, n x n). L has a unit diagonal.
+// throws if the matrix is singular.
+inline void lu_decompose(std::vector<double>& a_A, size_t a_n, std::vector<size_t>& a_pivot)
+{
+  a_pivot.resize(a_n);
+  for(size_t i = 0; i < a_n; ++i) {
+    a_pivot[i] = i;
+  }
+  for(size_t k = 0; k < a_n; ++k) {
+    size_t p = k;
+    for(size_t i = k + 1; i < a_n; ++i) {
+      if(std::abs(a_A[i * a_n + k]) > std::abs(a_A[p * a_n + k])) {
+        p = i;
+      }
+    }
+    if(a_A[p * a_n + k] == 0) {
+      throw std::runtime_error("uncertain_matrix: the matrix is singular.");
+    }
+    if(p != k) {
+      std::swap_ranges(a_A.begin() + k * a_n, a_A.begin() + (k + 1) * a_n, a_A.begin() + p * a_n);
+      std::swap(a_pivot[k], a_pivot[p]);
+    }
+    double* rk = &a_A[k * a_n];
+    for(size_t i = k + 1; i < a_n; ++i) {
+      double* ri = &a_A[i * a_n];
+      ri[k] /= rk[k];
+      for(size_t j = k + 1; j < a_n; ++j) {
+        ri[j] -= ri[k] * rk[j];
+      }
+    }
+  }
+}
+
+// solve LU X = P B for the columns [a_begin, a_end) of B (n x p, row-major), in place.
+inline void lu_solve(const std::vector<double>& a_LU, size_t a_n, const std::vector<size_t>& a_pivot, std::vector<double>& a_B, size_t a_p, size_t a_begin,
+                     size_t a_end)
+{
+  std::vector<double> x(a_n);
+  for(size_t c = a_begin; c < a_end; ++c) {
+    for(size_t i = 0; i < a_n; ++i) {
+      x[i] = a_B[a_pivot[i] * a_p + c];
+    }
+    for(size_t i = 0; i < a_n; ++i) {
+      for(size_t j = 0; j < i; ++j) {
+        x[i] -= a_LU[i * a_n + j] * x[j];
+      }
+    }
+    for(size_t i = a_n; i-- > 0;) {
+      for(size_t j = i + 1; j < a_n; ++j) {
+        x[i] -= a_LU[i * a_n + j] * x[j];
+      }
+      x[i] /= a_LU[i * a_n + i];
+    }
+    for(size_t i = 0; i < a_n; ++i) {
+      a_B[i * a_p + c] = x[i];
+    }
+  }
+}
+
+// the LU factorization of the nominal values of a square matrix.
+struct nominal_lu {
+  size_t              n = 0;
+  std::vector<double> LU;
+  std::vector<size_t> pivot;
+
+  explicit nominal_lu(const uncertain_matrix& a_A) : n(a_A.rows()), LU(a_A.nominal())
+  {
+    if(a_A.rows() != a_A.cols()) {
+      throw std::invalid_argument("uncertain_matrix: the matrix is not square.");
+    }
+    lu_decompose(LU, n, pivot);
+  }
+
+  // solve A X = B in place for B (n x p, row-major), with the columns split across threads.
+  void solve(std::vector<double>& a_B, size_t a_p, size_t a_threads) const
+  {
+    parallel_for(a_p, a_threads, [&](size_t a_begin, size_t a_end) { lu_solve(LU, n, pivot, a_B, a_p, a_begin, a_end); });
+  }
+
+  std::vector<double> inverse(size_t a_threads) const
+  {
+    std::vector<double> inv(n * n, 0.);
+    for(size_t i = 0; i < n; ++i) {
+      inv[i * n + i] = 1;
+    }
+    solve(inv, n, a_threads);
+    return inv;
+  }
+};
+}  // namespace detail
+
+inline uncertain_matrix uncertain_matrix::multiply(const uncertain_matrix& a_B, size_t a_threads) const
+{
+  if(cols() != a_B.rows()) {
+    throw std::invalid_argument("uncertain_matrix: the matrix sizes do not match for multiplication.");
+  }
+  size_t           n = rows(), m = cols(), p = a_B.cols();
+  uncertain_matrix C(n, p);
+  detail::matrix_multiply(nominal().data(), a_B.nominal().data(), C.nominal().data(), n, m, p, a_threads);
+  std::vector<double> var(n * p), term(n * p);
+  detail::matrix_multiply(detail::squared(nominal()).data(), detail::squared(a_B.uncertainty()).data(), var.data(), n, m, p, a_threads);
+  detail::matrix_multiply(detail::squared(uncertainty()).data(), detail::squared(a_B.nominal()).data(), term.data(), n, m, p, a_threads);
+  for(size_t i = 0; i < n * p; ++i) {
+    C.uncertainty()[i] = std::sqrt(var[i] + term[i]);
+  }
+  return C;
+}
+
+inline uncertain_matrix uncertain_matrix::solve(const uncertain_matrix& a_B, size_t a_threads) const
+{
+  if(rows() != a_B.rows()) {
+    throw std::invalid_argument("uncertain_matrix: the matrix sizes do not match for solve.");
+  }
+  size_t             n = rows(), p = a_B.cols();
+  detail::nominal_lu lu(*this);
+  uncertain_matrix   X(n, p);
+  // the solution comes from the factorization, which is more accurate than multiplying by the inverse.
+  // the inverse is only needed for the uncertainty.
+  X.nominal() = a_B.nominal();
+  lu.solve(X.nominal(), p, a_threads);
+  std::vector<double> inverse = lu.inverse(a_threads);
+
+  std::vector<double> var = detail::squared(a_B.uncertainty());
+  std::vector<double> term(n * p);
+  detail::matrix_multiply(detail::squared(uncertainty()).data(), detail::squared(X.nominal()).data(), term.data(), n, n, p, a_threads);
+  for(size_t i = 0; i < n * p; ++i) {
+    var[i] += term[i];
+  }
+  detail::matrix_multiply(detail::squared(inverse).data(), var.data(), X.uncertainty().data(), n, n, p, a_threads);
+  for(auto& u : X.uncertainty()) {
+    u = std::sqrt(u);
+  }
+  return X;
+}
+
+inline uncertain_matrix uncertain_matrix::inverse(size_t a_threads) const
+{
+  size_t              n    = rows();
+  std::vector<double> inv  = detail::nominal_lu(*this).inverse(a_threads);
+  std::vector<double> inv2 = detail::squared(inv);
+  std::vector<double> term(n * n);
+  uncertain_matrix    X(n, n);
+  X.nominal() = inv;
+  detail::matrix_multiply(inv2.data(), detail::squared(uncertainty()).data(), term.data(), n, n, n, a_threads);
+  detail::matrix_multiply(term.data(), inv2.data(), X.uncertainty().data(), n, n, n, a_threads);
+  for(auto& u : X.uncertainty()) {
+    u = std::sqrt(u);
+  }
+  return X;
+}
+
+inline uncertain_matrix operator*(const uncertain_matrix& a_A, const uncertain_matrix& a_B) { return a_A.multiply(a_B); }
+
+}  // namespace libUncertainty
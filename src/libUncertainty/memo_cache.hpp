@@ -0,0 +1,330 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "./utils.hpp"
+
+/** @file memo_cache.hpp
+ * @brief An in-process cache for memoizing functions used with error propagation.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+/**
+ * A bounded cache of function results, keyed on the exact bytes of the (raw) argument values.
+ *
+ * The cache is a set-associative hash table: each key hashes to a set of `Ways` slots, and
+ * when a set is full the least recently used slot in the set is replaced. Lookups do not take
+ * a lock (each slot is protected by a sequence counter, a reader that sees a slot being written
+ * treats it as a miss). Inserts are serialized with a mutex.
+ *
+ * Keys are sequences of at most MaxArity 64-bit words (one per double argument), and values are
+ * trivially copyable types of up to 16 bytes.
+ */
+template<size_t MaxArity = 20, size_t Ways = 4>
+class memo_cache
+{
+ public:
+  /**
+   * Create a cache with room for (at least) a_capacity results.
+   */
+  memo_cache(size_t a_capacity = 1024)
+  {
+    if(a_capacity == 0) {
+      throw std::invalid_argument("memo_cache capacity must be at least one.");
+    }
+    // round the number of sets up to a power of two so the set index is a mask
+    m_sets = 1;
+    while(m_sets * Ways < a_capacity) {
+      m_sets *= 2;
+    }
+    m_slots = std::make_unique<slot[]>(m_sets * Ways);
+  }
+
+  size_t capacity() const { return m_sets * Ways; }
+  size_t hits() const { return m_hits.load(std::memory_order_relaxed); }
+  size_t misses() const { return m_misses.load(std::memory_order_relaxed); }
+
+  /**
+   * Look up the result for a key of a_n words. Does not lock.
+   *
+   * An entry only matches if it was stored with a Value of the same size.
+   */
+  template<typename Value>
+  std::optional<Value> get(const uint64_t* a_key, size_t a_n)
+  {
+    check_arity(a_n);
+    check_value<Value>();
+    uint64_t hash = hash_words(a_key, a_n);
+    slot*    set  = &m_slots[(hash & (m_sets - 1)) * Ways];
+    for(size_t w = 0; w < Ways; ++w) {
+      value_words value;
+      if(set[w].read(hash, a_key, a_n, sizeof(Value), value)) {
+        set[w].last_used.store(m_tick.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        Value val;
+        std::memcpy(&val, value.data(), sizeof(Value));
+        return val;
+      }
+    }
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+  }
+
+  /**
+   * Store the result for a key of a_n words.
+   */
+  template<typename Value>
+  void put(const uint64_t* a_key, size_t a_n, const Value& a_value)
+  {
+    check_arity(a_n);
+    check_value<Value>();
+    value_words value{};
+    std::memcpy(value.data(), &a_value, sizeof(Value));
+    uint64_t                    hash = hash_words(a_key, a_n);
+    std::lock_guard<std::mutex> lock(m_write_mutex);
+    slot*                       set    = &m_slots[(hash & (m_sets - 1)) * Ways];
+    slot*                       target = &set[0];
+    for(size_t w = 0; w < Ways; ++w) {
+      value_words old;
+      if(set[w].read(hash, a_key, a_n, sizeof(Value), old)) {
+        target = &set[w];
+        break;
+      }
+      if(set[w].last_used.load(std::memory_order_relaxed) < target->last_used.load(std::memory_order_relaxed)) {
+        target = &set[w];
+      }
+    }
+    target->write(hash, a_key, a_n, sizeof(Value), value);
+    target->last_used.store(m_tick.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  /**
+   * Look up the result for a set of double argument values. Does not lock.
+   */
+  std::optional<double> get(const double* a_args, size_t a_n)
+  {
+    check_arity(a_n);
+    std::array<uint64_t, MaxArity> key;
+    std::memcpy(key.data(), a_args, a_n * sizeof(double));
+    return get<double>(key.data(), a_n);
+  }
+
+  /**
+   * Store the result for a set of double argument values.
+   */
+  void put(const double* a_args, size_t a_n, double a_value)
+  {
+    check_arity(a_n);
+    std::array<uint64_t, MaxArity> key;
+    std::memcpy(key.data(), a_args, a_n * sizeof(double));
+    put(key.data(), a_n, a_value);
+  }
+
+  /**
+   * Remove all entries (and reset the hit/miss counters).
+   */
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_write_mutex);
+    for(size_t i = 0; i < m_sets * Ways; ++i) {
+      m_slots[i].invalidate();
+    }
+    m_hits.store(0, std::memory_order_relaxed);
+    m_misses.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  using value_words = std::array<uint64_t, 2>;
+
+  static void check_arity(size_t a_n)
+  {
+    if(a_n > MaxArity) {
+      throw std::invalid_argument("memo_cache key has more than MaxArity words.");
+    }
+  }
+
+  // FNV-1a over the bytes of the key. for doubles this is the same as hash_values(...).
+  static uint64_t hash_words(const uint64_t* a_key, size_t a_n)
+  {
+    uint64_t hash = 14695981039346656037ull;
+    for(size_t i = 0; i < a_n; ++i) {
+      unsigned char bytes[sizeof(uint64_t)];
+      std::memcpy(bytes, a_key + i, sizeof(uint64_t));
+      for(auto b : bytes) {
+        hash = (hash ^ b) * 1099511628211ull;
+      }
+    }
+    return hash;
+  }
+
+  template<typename Value>
+  static void check_value()
+  {
+    static_assert(std::is_trivially_copyable<Value>::value && sizeof(Value) <= sizeof(value_words),
+                  "memo_cache values must be trivially copyable and at most 16 bytes.");
+  }
+
+  // a cache entry protected by a sequence counter. the counter is odd while the slot is being written.
+  // all fields are atomics, so a reader that races with a writer reads stale values (and then
+  // retries or misses), never undefined ones.
+  struct slot {
+    std::atomic<uint64_t>                        sequence{0};
+    std::atomic<uint64_t>                        hash{0};
+    std::atomic<uint64_t>                        size{0};  // number of key words + 1, 0 for an empty slot
+    std::atomic<uint64_t>                        value_size{0};
+    std::array<std::atomic<uint64_t>, MaxArity> key{};
+    std::array<std::atomic<uint64_t>, 2>        value{};
+    std::atomic<uint64_t>                        last_used{0};
+
+    bool read(uint64_t a_hash, const uint64_t* a_key, size_t a_n, size_t a_value_size, value_words& a_value) const
+    {
+      while(true) {
+        uint64_t seq = sequence.load(std::memory_order_acquire);
+        if(seq & 1) {
+          return false;
+        }
+        bool match = hash.load(std::memory_order_relaxed) == a_hash && size.load(std::memory_order_relaxed) == a_n + 1 &&
+                     value_size.load(std::memory_order_relaxed) == a_value_size;
+        for(size_t i = 0; match && i < a_n; ++i) {
+          match = key[i].load(std::memory_order_relaxed) == a_key[i];
+        }
+        value_words words{value[0].load(std::memory_order_relaxed), value[1].load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(sequence.load(std::memory_order_relaxed) == seq) {
+          a_value = words;
+          return match;
+        }
+      }
+    }
+
+    // must be called with the write mutex held
+    void write(uint64_t a_hash, const uint64_t* a_key, size_t a_n, size_t a_value_size, const value_words& a_value)
+    {
+      uint64_t seq = sequence.load(std::memory_order_relaxed);
+      sequence.store(seq + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      hash.store(a_hash, std::memory_order_relaxed);
+      size.store(a_n + 1, std::memory_order_relaxed);
+      value_size.store(a_value_size, std::memory_order_relaxed);
+      for(size_t i = 0; i < a_n; ++i) {
+        key[i].store(a_key[i], std::memory_order_relaxed);
+      }
+      value[0].store(a_value[0], std::memory_order_relaxed);
+      value[1].store(a_value[1], std::memory_order_relaxed);
+      sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    void invalidate()
+    {
+      uint64_t seq = sequence.load(std::memory_order_relaxed);
+      sequence.store(seq + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      size.store(0, std::memory_order_relaxed);
+      last_used.store(0, std::memory_order_relaxed);
+      sequence.store(seq + 2, std::memory_order_release);
+    }
+  };
+
+  size_t                  m_sets = 0;
+  std::unique_ptr<slot[]> m_slots;
+  std::mutex              m_write_mutex;
+  std::atomic<uint64_t>   m_tick{1};
+  std::atomic<size_t>     m_hits{0};
+  std::atomic<size_t>     m_misses{0};
+};
+
+namespace detail
+{
+// the number of bytes of a value that hold its value. an x87 long double is 10 bytes stored in
+// 12 or 16, and the rest is padding that may hold anything.
+template<typename T>
+constexpr size_t value_bytes()
+{
+  if constexpr(std::is_same<T, long double>::value && std::numeric_limits<long double>::digits == 64) {
+    return 10;
+  } else {
+    return sizeof(T);
+  }
+}
+
+template<typename T>
+constexpr size_t key_words()
+{
+  return (value_bytes<T>() + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+}
+
+// copy the value bytes of a_val to a_out (zero padded to whole words) and return the next word.
+template<typename T>
+uint64_t* write_key(const T& a_val, uint64_t* a_out)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "memoized_function arguments (with units stripped) must be trivially copyable.");
+  std::memset(a_out, 0, key_words<T>() * sizeof(uint64_t));
+  std::memcpy(a_out, &a_val, value_bytes<T>());
+  return a_out + key_words<T>();
+}
+}  // namespace detail
+
+/**
+ * A function wrapper that looks results up in a memo_cache before calling the function.
+ *
+ * Copies of the wrapper share the cache, so it can be passed to propagate_error(...) by value.
+ * When the same function is propagated again with only some inputs changed, only the
+ * evaluation points that actually changed are computed.
+ *
+ * The key is the exact bytes of each argument (with units stripped), and the result is stored
+ * with its own type, so no precision is lost for long double (or integer) arguments and results.
+ */
+template<typename F, size_t MaxArity = 20>
+struct memoized_function {
+  F                                     f;
+  std::shared_ptr<memo_cache<MaxArity>> cache;
+
+  template<typename... Args>
+  auto operator()(Args... args) const -> decltype(f(args...))
+  {
+    constexpr size_t words = (detail::key_words<decltype(strip_unit(args))>() + ... + 0);
+    static_assert(words <= MaxArity, "memoized_function called with arguments that take more than MaxArity key words.");
+    using result_type = decltype(f(args...));
+    using raw_type    = decltype(strip_unit(std::declval<result_type>()));
+    std::array<uint64_t, words> key;
+    uint64_t*                   out = key.data();
+    ((out = detail::write_key(strip_unit(args), out)), ...);
+    if(auto val = cache->template get<raw_type>(key.data(), key.size())) {
+      return attach_unit<result_type>(*val);
+    }
+    result_type result = f(args...);
+    cache->put(key.data(), key.size(), strip_unit(result));
+    return result;
+  }
+};
+
+/**
+ * Wrap a function so that its results are memoized in a bounded, in-process cache.
+ *
+ * example:
+ *
+ * auto f = memoize(expensive_model, 4096);
+ * for(...) {
+ *   auto y = basic_error_propagator::propagate_error(f, a, b, c);  // only changed points are evaluated
+ * }
+ * f.cache->hits();
+ */
+template<typename F>
+memoized_function<F> memoize(F a_f, size_t a_capacity = 1024)
+{
+  return {std::move(a_f), std::make_shared<memo_cache<>>(a_capacity)};
+}
+
+}  // namespace libUncertainty
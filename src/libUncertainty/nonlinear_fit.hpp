@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "./linear_fit.hpp"
+#include "./uncertain_core.hpp"
+#include "./utils.hpp"
+
+/** @file nonlinear_fit.hpp
+ * @brief Nonlinear least-squares fitting of uncertain data (Levenberg-Marquardt), with the parameter covariance.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+struct levenberg_marquardt_options {
+  size_t max_iterations = 200;
+  // stop when the relative decrease of chi^2 in an accepted step is less than this
+  double tolerance      = 1e-10;
+  double initial_lambda = 1e-3;
+  // the number of threads used to evaluate the residuals and Jacobian over the data points.
+  // with more than one thread, the model is called concurrently, so it must be thread-safe.
+  size_t threads        = 1;
+};
+
+/**
+ * The result of a nonlinear least-squares fit with M parameters.
+ */
+template<size_t M>
+struct nonlinear_fit_result : linear_fit_result<M> {
+  size_t iterations = 0;
+  bool   converged  = false;
+};
+
+namespace detail
+{
+// the data and model of a nonlinear least-squares problem.
+template<typename Model, size_t M>
+struct nonlinear_least_squares_problem {
+  Model               model;
+  std::vector<double> x, y, weight;
+  size_t              threads = 1;
+
+  double evaluate(double a_x, const std::array<double, M>& a_p) const
+  {
+    return std::apply([this, a_x](auto... p) { return static_cast<double>(model(a_x, p...)); }, a_p);
+  }
+
+  // run a_func(begin, end, accumulator) over chunks of the data on the given number of threads
+  // and merge the accumulators.
+  template<typename Func>
+  linear_least_squares_accumulator<M> reduce(Func a_func) const
+  {
+    size_t                                           n      = x.size();
+    size_t                                           chunks = std::max<size_t>(1, std::min(threads, n));
+    std::vector<linear_least_squares_accumulator<M>> partial(chunks);
+    std::vector<std::thread>                         workers;
+    for(size_t t = 1; t < chunks; ++t) {
+      workers.emplace_back([&, t]() { a_func(n * t / chunks, n * (t + 1) / chunks, partial[t]); });
+    }
+    a_func(0, n / chunks, partial[0]);
+    for(auto& w : workers) {
+      w.join();
+    }
+    for(size_t t = 1; t < chunks; ++t) {
+      partial[0].merge(partial[t]);
+    }
+    return partial[0];
+  }
+
+  // linearize the model at a_p: accumulate J^T W J, J^T W r and r^T W r,
+  // with the Jacobian computed by forward differences (like the error propagator).
+  linear_least_squares_accumulator<M> linearize(const std::array<double, M>& a_p) const
+  {
+    return reduce([&](size_t a_begin, size_t a_end, linear_least_squares_accumulator<M>& a_acc) {
+      std::array<double, M> row;
+      for(size_t i = a_begin; i < a_end; ++i) {
+        double f = evaluate(x[i], a_p);
+        for(size_t k = 0; k < M; ++k) {
+          auto   p = a_p;
+          double h = std::sqrt(std::numeric_limits<double>::epsilon()) * std::max(std::abs(p[k]), 1.);
+          p[k] += h;
+          row[k] = (evaluate(x[i], p) - f) / h;
+        }
+        a_acc.add(row, y[i] - f, weight[i]);
+      }
+    });
+  }
+
+  double chi2(const std::array<double, M>& a_p) const
+  {
+    return reduce([&](size_t a_begin, size_t a_end, linear_least_squares_accumulator<M>& a_acc) {
+             std::array<double, M> zeros{};
+             for(size_t i = a_begin; i < a_end; ++i) {
+               a_acc.add(zeros, y[i] - evaluate(x[i], a_p), weight[i]);
+             }
+           })
+        .weighted_sum_of_squares();
+  }
+
+  nonlinear_fit_result<M> solve(std::array<double, M> a_p, const levenberg_marquardt_options& a_options, bool a_scale_covariance) const
+  {
+    nonlinear_fit_result<M> result;
+    double                  lambda = a_options.initial_lambda;
+    auto                    lin    = linearize(a_p);
+    double                  chi2   = lin.weighted_sum_of_squares();
+    for(result.iterations = 0; result.iterations < a_options.max_iterations && !result.converged; ++result.iterations) {
+      // solve (J^T W J + lambda diag(J^T W J)) delta = J^T W r
+      std::array<double, M * M> A;
+      std::array<double, M>     delta;
+      for(size_t i = 0; i < M; ++i) {
+        for(size_t j = 0; j < M; ++j) {
+          A[i * M + j] = lin.normal(i, j) * (i == j ? 1 + lambda : 1);
+        }
+        delta[i] = lin.rhs(i);
+      }
+      if(!cholesky_decompose(A.data(), M)) {
+        lambda *= 10;
+        continue;
+      }
+      cholesky_forward(A.data(), M, delta.data());
+      cholesky_backward(A.data(), M, delta.data());
+
+      auto p = a_p;
+      for(size_t k = 0; k < M; ++k) {
+        p[k] += delta[k];
+      }
+      double new_chi2 = this->chi2(p);
+      if(new_chi2 <= chi2) {
+        result.converged = chi2 - new_chi2 <= a_options.tolerance * std::max(chi2, std::numeric_limits<double>::min());
+        a_p              = p;
+        chi2             = new_chi2;
+        lambda           = std::max(lambda / 10, 1e-12);
+        lin              = linearize(a_p);
+      } else {
+        lambda *= 10;
+        // no step in any direction reduces chi^2, we are at the minimum (to machine precision)
+        result.converged = lambda > 1e16;
+      }
+    }
+
+    // the covariance is the inverse of J^T W J at the solution
+    static_cast<linear_fit_result<M>&>(result) = lin.solve(a_scale_covariance);
+    for(size_t k = 0; k < M; ++k) {
+      result.parameters[k].nominal(a_p[k]);
+    }
+    result.chi2 = chi2;
+    return result;
+  }
+};
+}  // namespace detail
+
+/**
+ * Fit a nonlinear model y = f(x, p_0, ..., p_{M-1}) to a set of (x,y) points with the Levenberg-Marquardt method.
+ *
+ * x and y may be uncertain or plain numbers, and they are handled like linear_fit(...) does: the fit is
+ * weighted by 1/sigma_y^2 if y has uncertainties (otherwise the covariance is estimated from the residuals, which
+ * needs more points than parameters),
+ * and uncertainties in x are included with the effective variance method, sigma^2 = sigma_y^2 + (f(x + sigma_x) - f(x))^2,
+ * in a second fit that starts from the result of the first. Uncertainties in x need uncertainties in y.
+ *
+ * The Jacobian is computed with forward differences. The parameter covariance is (J^T W J)^-1 at the solution.
+ *
+ * @param a_model the model, called as a_model(x, p_0, ..., p_{M-1}).
+ * @param a_initial the initial parameter values.
+ */
+template<typename Model, size_t M, typename XIterator, typename YIterator>
+nonlinear_fit_result<M> nonlinear_fit(Model a_model, const std::array<double, M>& a_initial, XIterator a_x_begin, XIterator a_x_end, YIterator a_y_begin,
+                                      const levenberg_marquardt_options& a_options = {})
+{
+  detail::nonlinear_least_squares_problem<Model, M> problem{a_model, {}, {}, {}};
+  problem.threads   = a_options.threads;
+  bool weighted     = false;
+  bool x_uncertain  = false;
+  std::vector<double> sigma_x;
+  auto                yi = a_y_begin;
+  for(auto x = a_x_begin; x != a_x_end; ++x, ++yi) {
+    problem.x.push_back(get_nominal(*x));
+    problem.y.push_back(get_nominal(*yi));
+    double sy = get_uncertainty(*yi);
+    problem.weight.push_back(sy * sy);
+    sigma_x.push_back(get_uncertainty(*x));
+    weighted    = weighted || sy != 0;
+    x_uncertain = x_uncertain || sigma_x.back() != 0;
+  }
+  if(problem.x.size() < M) {
+    throw std::invalid_argument("nonlinear_fit needs at least as many points as parameters.");
+  }
+  if(!weighted && x_uncertain) {
+    throw std::invalid_argument("nonlinear_fit: x values with uncertainties need y values with uncertainties.");
+  }
+  if(!weighted && problem.x.size() == M) {
+    throw std::invalid_argument("nonlinear_fit needs more points than parameters to estimate the covariance from the residuals.");
+  }
+  // the weight vector holds the variances until here
+  std::vector<double> variance = problem.weight;
+  for(auto& w : problem.weight) {
+    if(weighted && !(w > 0)) {
+      throw std::invalid_argument("nonlinear_fit: weighted fit with a point that has zero uncertainty.");
+    }
+    w = weighted ? 1 / w : 1;
+  }
+
+  auto result = problem.solve(a_initial, a_options, !weighted);
+  if(weighted && x_uncertain) {
+    std::array<double, M> p;
+    for(size_t k = 0; k < M; ++k) {
+      p[k] = result.parameters[k].nominal();
+    }
+    for(size_t i = 0; i < problem.x.size(); ++i) {
+      double dy         = problem.evaluate(problem.x[i] + sigma_x[i], p) - problem.evaluate(problem.x[i], p);
+      problem.weight[i] = 1 / (variance[i] + dy * dy);
+    }
+    auto iterations = result.iterations;
+    result          = problem.solve(p, a_options, false);
+    result.iterations += iterations;
+  }
+  return result;
+}
+
+}  // namespace libUncertainty
@@ -0,0 +1,359 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "./correlation.hpp"
+#include "./uncertain_core.hpp"
+#include "./utils.hpp"
+
+/** @file ode.hpp
+ * @brief Error propagation through ODE integration with the forward sensitivity equations.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+enum class ode_method {
+  // classic fourth order Runge-Kutta with a fixed number of steps per output interval
+  rk4,
+  // Dormand-Prince 5(4) with adaptive step size control
+  dormand_prince
+};
+
+struct ode_options {
+  ode_method method = ode_method::dormand_prince;
+  // rk4: the number of steps taken in each output interval
+  size_t steps = 1000;
+  // dormand_prince: the error tolerances (applied to the state and the sensitivities) and the step limit
+  double relative_tolerance = 1e-8;
+  double absolute_tolerance = 1e-10;
+  size_t max_steps          = 1000000;
+};
+
+/**
+ * The state of an ODE system with S components and P uncertain parameters at time t.
+ */
+template<size_t S, size_t P>
+struct ode_sensitivity_result {
+  double                           t = 0;
+  std::array<uncertain<double>, S> state;
+  // the correlation between the state components
+  correlation_matrix<double>           correlation;
+  std::array<std::array<double, S>, S> covariance;
+  // the sensitivities of the state to the parameters, d state[i] / d p[k]
+  std::array<std::array<double, P>, S> sensitivities;
+};
+
+namespace detail
+{
+// the ODE system augmented with the forward sensitivity equations.
+//
+// the augmented state is z = (x, s_0, ..., s_{P-1}) with s_k = dx/dp_k, and
+// ds_k/dt = (df/dx) s_k + df/dp_k. the right hand side of each sensitivity equation
+// is a directional derivative of f, computed with one forward difference, so each
+// evaluation of the augmented system costs P+1 evaluations of f.
+template<typename F, size_t S, size_t P>
+struct ode_sensitivity_system {
+  static constexpr size_t size = S * (P + 1);
+  using vector                 = std::array<double, size>;
+
+  F                     f;
+  std::array<double, P> p;
+
+  vector operator()(double a_t, const vector& a_z) const
+  {
+    vector                z;
+    std::array<double, S> x;
+    std::copy(a_z.begin(), a_z.begin() + S, x.begin());
+    std::array<double, S> fx = f(a_t, x, p);
+    std::copy(fx.begin(), fx.end(), z.begin());
+
+    double x_scale = 1;
+    for(size_t i = 0; i < S; ++i) {
+      x_scale = std::max(x_scale, std::abs(x[i]));
+    }
+    for(size_t k = 0; k < P; ++k) {
+      const double* s       = &a_z[S * (k + 1)];
+      double        s_scale = 1;
+      for(size_t i = 0; i < S; ++i) {
+        s_scale = std::max(s_scale, std::abs(s[i]));
+      }
+      // the step moves p_k by h and x by h s, keep both small relative to their own scale.
+      double p_scale = p[k] != 0 ? std::abs(p[k]) : 1;
+      double h       = std::sqrt(std::numeric_limits<double>::epsilon()) * std::min(p_scale, x_scale / s_scale);
+      auto   xh = x;
+      auto   ph = p;
+      for(size_t i = 0; i < S; ++i) {
+        xh[i] += h * s[i];
+      }
+      ph[k] += h;
+      std::array<double, S> fh = f(a_t, xh, ph);
+      for(size_t i = 0; i < S; ++i) {
+        z[S * (k + 1) + i] = (fh[i] - fx[i]) / h;
+      }
+    }
+    return z;
+  }
+};
+
+// returns a_z + a_scale * a_dz
+template<size_t N>
+std::array<double, N> axpy(const std::array<double, N>& a_z, double a_scale, const std::array<double, N>& a_dz)
+{
+  std::array<double, N> z;
+  for(size_t i = 0; i < N; ++i) {
+    z[i] = a_z[i] + a_scale * a_dz[i];
+  }
+  return z;
+}
+
+// integrate from a_t0 to a_t1 with a_steps classic Runge-Kutta steps.
+template<typename System>
+void rk4_integrate(const System& a_system, double a_t0, double a_t1, size_t a_steps, typename System::vector& a_z)
+{
+  if(a_steps == 0) {
+    throw std::invalid_argument("ode_propagate: the rk4 method needs at least one step.");
+  }
+  double h = (a_t1 - a_t0) / a_steps;
+  for(size_t n = 0; n < a_steps; ++n) {
+    double t  = a_t0 + n * h;
+    auto   k1 = a_system(t, a_z);
+    auto   k2 = a_system(t + h / 2, axpy(a_z, h / 2, k1));
+    auto   k3 = a_system(t + h / 2, axpy(a_z, h / 2, k2));
+    auto   k4 = a_system(t + h, axpy(a_z, h, k3));
+    for(size_t i = 0; i < a_z.size(); ++i) {
+      a_z[i] += h / 6 * (k1[i] + 2 * k2[i] + 2 * k3[i] + k4[i]);
+    }
+  }
+}
+
+// integrate from a_t0 to a_t1 with the Dormand-Prince 5(4) method. a_h is the initial step size
+// (0 to choose one), it is updated with the step size proposed for the next interval.
+template<typename System>
+void dormand_prince_integrate(const System& a_system, double a_t0, double a_t1, const ode_options& a_options, typename System::vector& a_z, double& a_h)
+{
+  using vector = typename System::vector;
+  // the Butcher tableau
+  constexpr double c2 = 1. / 5, c3 = 3. / 10, c4 = 4. / 5, c5 = 8. / 9;
+  constexpr double a21 = 1. / 5;
+  constexpr double a31 = 3. / 40, a32 = 9. / 40;
+  constexpr double a41 = 44. / 45, a42 = -56. / 15, a43 = 32. / 9;
+  constexpr double a51 = 19372. / 6561, a52 = -25360. / 2187, a53 = 64448. / 6561, a54 = -212. / 729;
+  constexpr double a61 = 9017. / 3168, a62 = -355. / 33, a63 = 46732. / 5247, a64 = 49. / 176, a65 = -5103. / 18656;
+  constexpr double b1 = 35. / 384, b3 = 500. / 1113, b4 = 125. / 192, b5 = -2187. / 6784, b6 = 11. / 84;
+  // the difference between the fifth and fourth order weights
+  constexpr double e1 = 71. / 57600, e3 = -71. / 16695, e4 = 71. / 1920, e5 = -17253. / 339200, e6 = 22. / 525, e7 = -1. / 40;
+
+  double direction = a_t1 > a_t0 ? 1 : -1;
+  double t         = a_t0;
+  double h         = a_h > 0 ? std::min(a_h, std::abs(a_t1 - a_t0)) : std::abs(a_t1 - a_t0) / 100;
+  auto   k1        = a_system(t, a_z);
+  size_t steps     = 0;
+  while(direction * (a_t1 - t) > 0) {
+    if(++steps > a_options.max_steps) {
+      throw std::runtime_error("ode_propagate: the maximum number of steps was exceeded.");
+    }
+    bool last = h >= std::abs(a_t1 - t);
+    if(last) {
+      h = std::abs(a_t1 - t);
+    }
+    double hs = direction * h;
+    vector z2, z3, z4, z5, z6, z7;
+    for(size_t i = 0; i < a_z.size(); ++i) {
+      z2[i] = a_z[i] + hs * a21 * k1[i];
+    }
+    auto k2 = a_system(t + c2 * hs, z2);
+    for(size_t i = 0; i < a_z.size(); ++i) {
+      z3[i] = a_z[i] + hs * (a31 * k1[i] + a32 * k2[i]);
+    }
+    auto k3 = a_system(t + c3 * hs, z3);
+    for(size_t i = 0; i < a_z.size(); ++i) {
+      z4[i] = a_z[i] + hs * (a41 * k1[i] + a42 * k2[i] + a43 * k3[i]);
+    }
+    auto k4 = a_system(t + c4 * hs, z4);
+    for(size_t i = 0; i < a_z.size(); ++i) {
+      z5[i] = a_z[i] + hs * (a51 * k1[i] + a52 * k2[i] + a53 * k3[i] + a54 * k4[i]);
+    }
+    auto k5 = a_system(t + c5 * hs, z5);
+    for(size_t i = 0; i < a_z.size(); ++i) {
+      z6[i] = a_z[i] + hs * (a61 * k1[i] + a62 * k2[i] + a63 * k3[i] + a64 * k4[i] + a65 * k5[i]);
+    }
+    auto k6 = a_system(t + hs, z6);
+    for(size_t i = 0; i < a_z.size(); ++i) {
+      z7[i] = a_z[i] + hs * (b1 * k1[i] + b3 * k3[i] + b4 * k4[i] + b5 * k5[i] + b6 * k6[i]);
+    }
+    auto k7 = a_system(t + hs, z7);
+
+    // the RMS of the error estimate, relative to the tolerance
+    double err = 0;
+    for(size_t i = 0; i < a_z.size(); ++i) {
+      double e     = hs * (e1 * k1[i] + e3 * k3[i] + e4 * k4[i] + e5 * k5[i] + e6 * k6[i] + e7 * k7[i]);
+      double scale = a_options.absolute_tolerance + a_options.relative_tolerance * std::max(std::abs(a_z[i]), std::abs(z7[i]));
+      err += (e / scale) * (e / scale);
+    }
+    err = std::sqrt(err / a_z.size());
+
+    if(err <= 1) {
+      t   = last ? a_t1 : t + hs;
+      a_z = z7;
+      k1  = k7;  // first same as last
+    }
+    double factor = err > 0 ? 0.9 * std::pow(err, -1. / 5) : 5.;
+    h *= std::clamp(factor, 0.2, 5.);
+    if(err <= 1 && !last) {
+      a_h = h;
+    }
+    if(t + direction * h == t) {
+      throw std::runtime_error("ode_propagate: the step size underflowed.");
+    }
+  }
+}
+
+template<typename F, size_t S, size_t P>
+void ode_integrate(const ode_sensitivity_system<F, S, P>& a_system, double a_t0, double a_t1, const ode_options& a_options,
+                   typename ode_sensitivity_system<F, S, P>::vector& a_z, double& a_h)
+{
+  if(a_options.method == ode_method::rk4) {
+    rk4_integrate(a_system, a_t0, a_t1, a_options.steps, a_z);
+  } else {
+    dormand_prince_integrate(a_system, a_t0, a_t1, a_options, a_z, a_h);
+  }
+}
+
+// compute the state covariance, C = S Sigma S^T, from the sensitivities and the parameter covariance.
+// the variances are sums of signed terms, so with strongly anti-correlated parameters the rounding errors in
+// the sensitivities can make them slightly negative. they are clamped to zero (which also keeps the correlations finite).
+template<size_t S, size_t P>
+ode_sensitivity_result<S, P> make_ode_result(double a_t, const std::array<double, S*(P + 1)>& a_z, const std::array<double, P>& a_sigma,
+                                             const correlation_matrix<double>* a_correlation)
+{
+  ode_sensitivity_result<S, P> result;
+  result.t = a_t;
+  for(size_t i = 0; i < S; ++i) {
+    for(size_t k = 0; k < P; ++k) {
+      result.sensitivities[i][k] = a_z[S * (k + 1) + i];
+    }
+  }
+  for(size_t i = 0; i < S; ++i) {
+    for(size_t j = i; j < S; ++j) {
+      double sum = 0;
+      for(size_t k = 0; k < P; ++k) {
+        for(size_t l = 0; l < P; ++l) {
+          double rho = k == l ? 1 : (a_correlation ? (*a_correlation)(k, l) : 0);
+          if(rho != 0) {
+            sum += result.sensitivities[i][k] * a_sigma[k] * rho * a_sigma[l] * result.sensitivities[j][l];
+          }
+        }
+      }
+      if(i == j) {
+        sum = std::max(sum, 0.);
+      }
+      result.covariance[i][j] = sum;
+      result.covariance[j][i] = sum;
+    }
+  }
+  result.correlation = correlation_matrix<double>(S);
+  for(size_t i = 0; i < S; ++i) {
+    result.state[i] = uncertain<double>(a_z[i], std::sqrt(result.covariance[i][i]));
+    for(size_t j = i + 1; j < S; ++j) {
+      double norm              = std::sqrt(result.covariance[i][i] * result.covariance[j][j]);
+      result.correlation(i, j) = norm > 0 ? result.covariance[i][j] / norm : 0;
+    }
+  }
+  return result;
+}
+
+template<typename F, size_t S, size_t P>
+std::vector<ode_sensitivity_result<S, P>> integrate_with_sensitivities(F a_f, const std::array<double, S>& a_x0, const std::array<uncertain<double>, P>& a_params,
+                                                                       const correlation_matrix<double>* a_correlation, const std::vector<double>& a_times,
+                                                                   const ode_options& a_options)
+{
+  if(a_times.empty()) {
+    throw std::invalid_argument("ode_propagate_trajectory: at least one time (the initial time) is required.");
+  }
+  if(a_correlation && a_correlation->size() != P) {
+    throw std::invalid_argument("ode_propagate: the correlation matrix size does not match the number of parameters.");
+  }
+  ode_sensitivity_system<F, S, P> system{a_f, {}};
+  std::array<double, P>           sigma;
+  for(size_t k = 0; k < P; ++k) {
+    system.p[k] = a_params[k].nominal();
+    sigma[k]    = a_params[k].uncertainty();
+  }
+  // the initial state does not depend on the parameters
+  typename ode_sensitivity_system<F, S, P>::vector z{};
+  std::copy(a_x0.begin(), a_x0.end(), z.begin());
+
+  std::vector<ode_sensitivity_result<S, P>> trajectory;
+  trajectory.reserve(a_times.size());
+  trajectory.push_back(make_ode_result<S, P>(a_times[0], z, sigma, a_correlation));
+  double h = 0;
+  for(size_t n = 1; n < a_times.size(); ++n) {
+    ode_integrate(system, a_times[n - 1], a_times[n], a_options, z, h);
+    trajectory.push_back(make_ode_result<S, P>(a_times[n], z, sigma, a_correlation));
+  }
+  return trajectory;
+}
+}  // namespace detail
+
+/**
+ * Integrate the ODE system dx/dt = f(t, x, p) from a_t0 to a_t1 and propagate the
+ * uncertainty in the parameters p to the final state.
+ *
+ * Instead of integrating the system N+1 times (once for each perturbed parameter), the
+ * forward sensitivity equations, ds_k/dt = (df/dx) s_k + df/dp_k with s_k = dx/dp_k, are
+ * integrated alongside the state in one pass. The state covariance is S Sigma_p S^T.
+ *
+ * f is called as f(double t, const std::array<double,S>& x, const std::array<double,P>& p)
+ * and returns std::array<double,S>. An uncertain initial condition can be handled by making it
+ * a parameter (integrate y = x - x0 instead).
+ *
+ * The integrator is selected with a_options.method (fixed-step rk4, or adaptive Dormand-Prince).
+ */
+template<typename F, size_t S, size_t P>
+ode_sensitivity_result<S, P> ode_propagate(F a_f, const std::array<double, S>& a_x0, const std::array<uncertain<double>, P>& a_params, double a_t0, double a_t1,
+                                           const ode_options& a_options = {})
+{
+  return detail::integrate_with_sensitivities(a_f, a_x0, a_params, nullptr, {a_t0, a_t1}, a_options).back();
+}
+
+/**
+ * Integrate an ODE system with correlated parameters.
+ */
+template<typename F, size_t S, size_t P>
+ode_sensitivity_result<S, P> ode_propagate(F a_f, const std::array<double, S>& a_x0, const std::array<uncertain<double>, P>& a_params,
+                                           const correlation_matrix<double>& a_correlation, double a_t0, double a_t1, const ode_options& a_options = {})
+{
+  return detail::integrate_with_sensitivities(a_f, a_x0, a_params, &a_correlation, {a_t0, a_t1}, a_options).back();
+}
+
+/**
+ * Integrate an ODE system and return the state, with uncertainties and correlations, at each of
+ * the times in a_times. The first time is the initial time.
+ */
+template<typename F, size_t S, size_t P>
+std::vector<ode_sensitivity_result<S, P>> ode_propagate_trajectory(F a_f, const std::array<double, S>& a_x0, const std::array<uncertain<double>, P>& a_params,
+                                                                   const std::vector<double>& a_times, const ode_options& a_options = {})
+{
+  return detail::integrate_with_sensitivities(a_f, a_x0, a_params, nullptr, a_times, a_options);
+}
+
+/**
+ * Integrate an ODE system with correlated parameters and return the state at each of the times in a_times.
+ */
+template<typename F, size_t S, size_t P>
+std::vector<ode_sensitivity_result<S, P>> ode_propagate_trajectory(F a_f, const std::array<double, S>& a_x0, const std::array<uncertain<double>, P>& a_params,
+                                                                   const correlation_matrix<double>& a_correlation, const std::vector<double>& a_times,
+                                                                   const ode_options& a_options = {})
+{
+  return detail::integrate_with_sensitivities(a_f, a_x0, a_params, &a_correlation, a_times, a_options);
+}
+
+}  // namespace libUncertainty
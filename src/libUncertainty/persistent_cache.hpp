@@ -0,0 +1,326 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/file.h>)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#define LIBUNCERTAINTY_HAS_FLOCK 1
+#endif
+
+#include "./utils.hpp"
+
+/** @file persistent_cache.hpp
+ * @brief A file-backed cache for memoizing expensive functions used with error propagation.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+/**
+ * A cache of function results stored in a local file.
+ *
+ * Entries are keyed on a model id (chosen by the user, it should change whenever the model
+ * changes) and the raw values of the arguments. The least recently used entries are removed
+ * when the cache holds more than `capacity` entries.
+ *
+ * Every access locks the file (with flock(...)) and reads it, so several processes can share one
+ * cache file. This is only worth it for functions that take much longer than reading the file,
+ * i.e. simulations that take seconds. Where <sys/file.h> is not available (e.g. Windows) the file
+ * is NOT locked, and it must not be shared between processes.
+ *
+ * Lines of the file that cannot be read are skipped (and dropped the next time the file is written).
+ */
+class persistent_cache
+{
+ public:
+  using path_type = std::filesystem::path;
+
+  persistent_cache(path_type a_path, size_t a_capacity = 1000) : m_path(std::move(a_path)), m_capacity(a_capacity)
+  {
+    if(m_capacity == 0) {
+      throw std::invalid_argument("persistent_cache capacity must be at least one.");
+    }
+  }
+
+  const path_type& path() const { return m_path; }
+  size_t           capacity() const { return m_capacity; }
+
+  /**
+   * Look up the result for a model and its (raw) argument values.
+   */
+  std::optional<double> get(const std::string& a_model, const std::vector<double>& a_args)
+  {
+    check_model_id(a_model);
+    file_lock lock(m_path);
+    auto      entries = load();
+    auto      it      = entries.find(make_key(a_model, a_args));
+    if(it == entries.end() || it->second.model != a_model || it->second.args != a_args) {
+      return std::nullopt;
+    }
+    it->second.last_used = next_tick(entries);
+    save(entries);
+    return it->second.value;
+  }
+
+  /**
+   * Store the result for a model and its (raw) argument values.
+   */
+  void put(const std::string& a_model, const std::vector<double>& a_args, double a_value)
+  {
+    check_model_id(a_model);
+    file_lock lock(m_path);
+    auto      entries = load();
+    auto      tick    = next_tick(entries);
+    entries[make_key(a_model, a_args)] = {a_model, a_args, a_value, tick};
+    while(entries.size() > m_capacity) {
+      auto oldest = entries.begin();
+      for(auto it = entries.begin(); it != entries.end(); ++it) {
+        if(it->second.last_used < oldest->second.last_used) {
+          oldest = it;
+        }
+      }
+      entries.erase(oldest);
+    }
+    save(entries);
+  }
+
+  /**
+   * Return the number of entries in the cache file.
+   */
+  size_t size() const
+  {
+    file_lock lock(m_path);
+    return load().size();
+  }
+
+  /**
+   * Remove all entries.
+   */
+  void clear()
+  {
+    file_lock lock(m_path);
+    save({});
+  }
+
+ private:
+  struct entry {
+    std::string         model;
+    std::vector<double> args;
+    double              value     = 0;
+    uint64_t            last_used = 0;
+  };
+  using map_type = std::unordered_map<std::string, entry>;
+
+  // an exclusive lock on a file next to the cache file, held for the lifetime of the object.
+  class file_lock
+  {
+   public:
+    file_lock(const path_type& a_path)
+    {
+#ifdef LIBUNCERTAINTY_HAS_FLOCK
+      auto lock_path = a_path.string() + ".lock";
+      m_fd           = ::open(lock_path.c_str(), O_RDWR | O_CREAT, 0644);
+      if(m_fd < 0 || ::flock(m_fd, LOCK_EX) != 0) {
+        throw std::runtime_error("Could not lock persistent cache file '" + lock_path + "'.");
+      }
+#endif
+    }
+    ~file_lock()
+    {
+#ifdef LIBUNCERTAINTY_HAS_FLOCK
+      ::flock(m_fd, LOCK_UN);
+      ::close(m_fd);
+#endif
+    }
+    file_lock(const file_lock&) = delete;
+    file_lock& operator=(const file_lock&) = delete;
+
+   private:
+    int m_fd = -1;
+  };
+
+  static void check_model_id(const std::string& a_model)
+  {
+    if(a_model.empty() || a_model.find_first_of(" \t\n\r") != std::string::npos) {
+      throw std::invalid_argument("persistent_cache model id '" + a_model + "' must not be empty or contain whitespace.");
+    }
+  }
+
+  // the key is the model id and a hash of the argument bits. the arguments are stored
+  // with each entry too, so a hash collision is a cache miss, not a wrong result.
+  static std::string make_key(const std::string& a_model, const std::vector<double>& a_args)
+  {
+    uint64_t hash = hash_values(a_args.data(), a_args.size());
+    char     buffer[17];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), hash, 16);
+    return a_model + ":" + std::string(buffer, result.ptr);
+  }
+
+  static uint64_t next_tick(const map_type& a_entries)
+  {
+    uint64_t tick = 0;
+    for(const auto& e : a_entries) {
+      tick = std::max(tick, e.second.last_used);
+    }
+    return tick + 1;
+  }
+
+  static void write_double(std::ostream& out, double a_val)
+  {
+    // shortest representation that reads back to the same value
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), a_val);
+    out.write(buffer, result.ptr - buffer);
+  }
+
+  static bool read_double(const std::string& a_str, double& a_val)
+  {
+    auto result = std::from_chars(a_str.data(), a_str.data() + a_str.size(), a_val);
+    return result.ec == std::errc() && result.ptr == a_str.data() + a_str.size();
+  }
+
+  // file format: one entry per line
+  // model nargs arg_1 ... arg_n value last_used
+  //
+  // returns false if the line is not a valid entry.
+  static bool parse_entry(const std::string& a_line, entry& a_entry)
+  {
+    std::istringstream fields(a_line);
+    size_t             n = 0;
+    std::string        tmp;
+    // each argument takes at least two characters, so a corrupt count cannot cause a huge allocation.
+    if(!(fields >> a_entry.model >> n) || n > a_line.size() / 2) {
+      return false;
+    }
+    a_entry.args.resize(n);
+    for(auto& a : a_entry.args) {
+      if(!(fields >> tmp) || !read_double(tmp, a)) {
+        return false;
+      }
+    }
+    if(!(fields >> tmp) || !read_double(tmp, a_entry.value) || !(fields >> a_entry.last_used)) {
+      return false;
+    }
+    return !(fields >> tmp);
+  }
+
+  map_type load() const
+  {
+    map_type      entries;
+    std::ifstream in(m_path);
+    std::string   line;
+    while(std::getline(in, line)) {
+      entry e;
+      if(!parse_entry(line, e)) {
+        continue;
+      }
+      auto key     = make_key(e.model, e.args);
+      entries[key] = std::move(e);
+    }
+    return entries;
+  }
+
+  // write to a temporary file and rename it, so the cache file is never left half written.
+  void save(const map_type& a_entries) const
+  {
+    auto tmp_path = m_path;
+    tmp_path += ".tmp";
+    {
+      std::ofstream out(tmp_path, std::ios::trunc);
+      if(!out) {
+        throw std::runtime_error("Could not write persistent cache file '" + tmp_path.string() + "'.");
+      }
+      for(const auto& e : a_entries) {
+        out << e.second.model << " " << e.second.args.size();
+        for(auto a : e.second.args) {
+          out << " ";
+          write_double(out, a);
+        }
+        out << " ";
+        write_double(out, e.second.value);
+        out << " " << e.second.last_used << "\n";
+      }
+    }
+    std::filesystem::rename(tmp_path, m_path);
+  }
+
+  path_type m_path;
+  size_t    m_capacity;
+};
+
+namespace detail
+{
+// true if every value of T converts to double and back without rounding (float, double, and integers up to 32 bits).
+template<typename T>
+constexpr bool exact_in_double()
+{
+  return std::is_arithmetic<T>::value && std::numeric_limits<T>::digits <= std::numeric_limits<double>::digits;
+}
+}  // namespace detail
+
+/**
+ * A function wrapper that looks results up in a persistent_cache before calling the function.
+ *
+ * The arguments (with units stripped) are used as the key, so the wrapper can be passed to
+ * propagate_error(...) in place of the function. The result must be a number or a Boost.Units quantity.
+ *
+ * The cache file stores doubles, so the arguments and the result (with units stripped) must
+ * convert to double exactly. Wider types (e.g. long double) are rejected at compile time, since
+ * nearby values would share an entry.
+ */
+template<typename F>
+struct persistent_memoized_function {
+  std::string       model_id;
+  F                 f;
+  persistent_cache* cache;
+
+  template<typename... Args>
+  auto operator()(Args... args) const -> decltype(f(args...))
+  {
+    using result_type = decltype(f(args...));
+    static_assert((detail::exact_in_double<decltype(strip_unit(args))>() && ...),
+                  "persistent_memoized_function arguments (with units stripped) must convert to double exactly.");
+    static_assert(detail::exact_in_double<decltype(strip_unit(std::declval<result_type>()))>(),
+                  "persistent_memoized_function results (with units stripped) must convert to double exactly.");
+    std::vector<double> key{static_cast<double>(strip_unit(args))...};
+    if(auto val = cache->get(model_id, key)) {
+      return attach_unit<result_type>(*val);
+    }
+    result_type result = f(args...);
+    cache->put(model_id, key, static_cast<double>(strip_unit(result)));
+    return result;
+  }
+};
+
+/**
+ * Wrap a function so that its results are stored in (and read from) a persistent cache.
+ *
+ * example:
+ *
+ * persistent_cache cache("simulation.cache");
+ * auto f = memoize_persistent(cache, "heat-sim-v3", run_simulation);
+ * auto T = basic_error_propagator::propagate_error(f, power, duration);
+ */
+template<typename F>
+persistent_memoized_function<F> memoize_persistent(persistent_cache& a_cache, std::string a_model_id, F a_f)
+{
+  return {std::move(a_model_id), std::move(a_f), &a_cache};
+}
+
+}  // namespace libUncertainty
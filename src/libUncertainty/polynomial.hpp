@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "./correlation.hpp"
+#include "./linear_fit.hpp"
+#include "./uncertain_core.hpp"
+#include "./utils.hpp"
+
+/** @file polynomial.hpp
+ * @brief Evaluating polynomials with uncertain (and correlated) coefficients.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+/**
+ * A polynomial p(x) = c_0 + c_1 x + ... + c_D x^D with uncertain, possibly correlated, coefficients.
+ *
+ * The variance of p(x) is the quadratic form m^T S m over the monomials m = (1, x, ..., x^D), where
+ * S is the coefficient covariance. Writing S = G^T G, this is var(x) = |G m|^2, and each row of G m
+ * is a polynomial in x. These are evaluated with Horner loops, so each point takes O(D^2) operations
+ * and no allocation, and the variance is a sum of squares that can not come out negative.
+ * propagate_error(...) with a correlation matrix needs D+2 evaluations of the polynomial per point.
+ *
+ * Summing m^T S m directly (or folding it into a single polynomial of degree 2D) cancels badly when
+ * the covariance is ill-conditioned, e.g. for a fit to data far from x = 0. In that case the elements of
+ * S do not hold enough digits to recover the variance, and the polynomial should be created from the
+ * linear_fit_result, which keeps the factor of the fit.
+ */
+class uncertain_polynomial
+{
+ public:
+  /**
+   * Create a polynomial from uncorrelated coefficients (c_0 first).
+   */
+  template<typename Coefficients, typename = decltype(get_nominal(std::declval<const Coefficients&>()[0]))>
+  explicit uncertain_polynomial(const Coefficients& a_coefficients) : uncertain_polynomial(a_coefficients, correlation_matrix<double>(a_coefficients.size()))
+  {
+  }
+  /**
+   * Create a polynomial from coefficients (c_0 first) with a correlation matrix.
+   *
+   * G is the transposed Cholesky factor of the correlation matrix, scaled by the uncertainties. A coefficient
+   * that is (to within rounding) fully correlated with the previous ones gets a zero row. An exception is
+   * thrown if the correlation matrix is not positive semi-definite.
+   */
+  template<typename Coefficients>
+  uncertain_polynomial(const Coefficients& a_coefficients, const correlation_matrix<double>& a_correlation)
+  {
+    size_t M = a_coefficients.size();
+    if(M == 0) {
+      throw std::invalid_argument("uncertain_polynomial: at least one coefficient is required.");
+    }
+    if(a_correlation.size() != M) {
+      throw std::invalid_argument("uncertain_polynomial: the correlation matrix size does not match the number of coefficients.");
+    }
+    m_nominal.resize(M);
+    m_factor.assign(M * M, 0.);
+    std::vector<double> L(M * M, 0.);
+    for(size_t j = 0; j < M; ++j) {
+      double d = 1;
+      for(size_t k = 0; k < j; ++k) {
+        d -= L[j * M + k] * L[j * M + k];
+      }
+      if(d < -1e-8) {
+        throw std::invalid_argument("uncertain_polynomial: the correlation matrix is not positive semi-definite.");
+      }
+      d            = d > 0 ? std::sqrt(d) : 0;
+      L[j * M + j] = d;
+      for(size_t i = j + 1; i < M; ++i) {
+        double s = a_correlation(i, j);
+        for(size_t k = 0; k < j; ++k) {
+          s -= L[i * M + k] * L[j * M + k];
+        }
+        L[i * M + j] = d > 0 ? s / d : 0;
+      }
+    }
+    for(size_t k = 0; k < M; ++k) {
+      m_nominal[k] = get_nominal(a_coefficients[k]);
+      double sigma = get_uncertainty(a_coefficients[k]);
+      for(size_t j = 0; j <= k; ++j) {
+        m_factor[j * M + k] = L[k * M + j] * sigma;
+      }
+    }
+  }
+  /**
+   * Create a polynomial from a fit with polynomial_basis<D>.
+   *
+   * The covariance of the fit is s (R^T R)^-1, where R is the factor of the fit and s the covariance scale,
+   * so G = sqrt(s) R^-T. This gives the same variance as a_fit.prediction_uncertainty(...), which does not
+   * depend on the conditioning of the covariance.
+   */
+  template<size_t M>
+  explicit uncertain_polynomial(const linear_fit_result<M>& a_fit) : m_nominal(M), m_factor(M * M, 0.)
+  {
+    double scale = std::sqrt(a_fit.covariance_scale);
+    for(size_t j = 0; j < M; ++j) {
+      m_nominal[j] = a_fit.parameters[j].nominal();
+      // column j of R^-1 (back substitution), which is row j of G
+      for(size_t i = j + 1; i-- > 0;) {
+        double s = i == j ? 1 : 0;
+        for(size_t k = i + 1; k <= j; ++k) {
+          s -= a_fit.factor[i][k] * m_factor[j * M + k];
+        }
+        m_factor[j * M + i] = s / a_fit.factor[i][i];
+      }
+    }
+    for(auto& g : m_factor) {
+      g *= scale;
+    }
+  }
+
+  size_t degree() const { return m_nominal.size() - 1; }
+
+  /**
+   * Evaluate the polynomial (and its uncertainty) at a single point.
+   */
+  uncertain<double> operator()(double a_x) const
+  {
+    double nominal, uncertainty;
+    evaluate(&a_x, 1, &nominal, &uncertainty);
+    return uncertain<double>(nominal, uncertainty);
+  }
+
+  /**
+   * Evaluate the polynomial at each point in [a_x_begin, a_x_end) and write the uncertain<double> results to a_out.
+   */
+  template<typename XIterator, typename OutputIterator>
+  OutputIterator evaluate(XIterator a_x_begin, XIterator a_x_end, OutputIterator a_out) const
+  {
+    for(auto x = a_x_begin; x != a_x_end; ++x) {
+      *a_out++ = (*this)(get_nominal(*x));
+    }
+    return a_out;
+  }
+
+  /**
+   * Evaluate the polynomial at a_n points, writing the nominal values and uncertainties to separate arrays.
+   * The loop over the points has no dependencies between iterations, so the compiler can vectorize it.
+   */
+  void evaluate(const double* a_x, size_t a_n, double* a_nominal, double* a_uncertainty) const
+  {
+    const double* c = m_nominal.data();
+    const double* g = m_factor.data();
+    size_t        M = m_nominal.size();
+    for(size_t i = 0; i < a_n; ++i) {
+      double x   = a_x[i];
+      double p   = horner(c, M, x);
+      double var = 0;
+      for(size_t j = 0; j < M; ++j) {
+        double u = horner(g + j * M, M, x);
+        var += u * u;
+      }
+      a_nominal[i]     = p;
+      a_uncertainty[i] = std::sqrt(var);
+    }
+  }
+
+  /**
+   * The factor G of the coefficient covariance, S = G^T G (M x M, row-major). Row j holds the
+   * coefficients of the polynomial (G m)_j, and var(x) is the sum of their squares.
+   */
+  const std::vector<double>& covariance_factor() const { return m_factor; }
+
+ private:
+  static double horner(const double* a_c, size_t a_M, double a_x)
+  {
+    double p = a_c[a_M - 1];
+    for(size_t k = a_M - 1; k-- > 0;) {
+      p = p * a_x + a_c[k];
+    }
+    return p;
+  }
+
+  std::vector<double> m_nominal;
+  std::vector<double> m_factor;
+};
+
+/**
+ * Evaluate a polynomial with correlated, uncertain coefficients (c_0 first) at each point in [a_x_begin, a_x_end).
+ *
+ * example:
+ *
+ * evaluate_polynomial(coefficients, correlation, points.begin(), points.end(), std::back_inserter(values));
+ *
+ * For the result of a polynomial fit, use uncertain_polynomial(fit).evaluate(...) instead.
+ */
+template<typename Coefficients, typename XIterator, typename OutputIterator>
+OutputIterator evaluate_polynomial(const Coefficients& a_coefficients, const correlation_matrix<double>& a_correlation, XIterator a_x_begin, XIterator a_x_end,
+                                   OutputIterator a_out)
+{
+  return uncertain_polynomial(a_coefficients, a_correlation).evaluate(a_x_begin, a_x_end, a_out);
+}
+
+}  // namespace libUncertainty
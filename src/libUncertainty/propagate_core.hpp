@@ -0,0 +1,2153 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <numeric>
+
+#include "./budget.hpp"
+#include "./tags.hpp"
+#include "./uncertain_core.hpp"
+#include "./utils.hpp"
+
+/** @file propagate_core.hpp
+  * @brief Error propagation, without the correlation containers.
+  *
+  * This header does not include correlation.hpp (and <map>) or <iostream>. The overloads
+  * that take a correlation matrix or store are still available, but correlation.hpp must
+  * be included to create the containers and to use propagate_error_and_correlation(...).
+  *
+  * @author C.D. Clark III
+  * @date 10/18/26
+  */
+
+namespace libUncertainty
+{
+// defined in correlation.hpp
+template<typename T>
+struct correlation_store;
+template<typename BASE, typename CoeffType>
+struct add_correlation_coefficient_array;
+
+/**
+ * The stages of an error propagation call.
+ *
+ * evaluate: evaluating the function at the nominal and perturbed points.
+ * combine: adding the deviations (and correlation terms) in quadrature.
+ * correlate: computing correlation coefficients for the result.
+ */
+enum class propagation_stage { evaluate = 0, combine = 1, correlate = 2 };
+
+/**
+ * The default instrumentation policy. It does nothing, and compiles away completely.
+ *
+ * An instrumentation policy provides a `recorder` type that the error propagator creates
+ * at the beginning of each call with the name of the overload and the type of the function.
+ * The recorder is notified of each stage, the heap allocations done by the propagator, and
+ * it may wrap the function to observe each evaluation.
+ *
+ * The recorder also receives trace hooks with the intermediate values of the calculation:
+ * the nominal value, each deviation, each correlation term added to the sum of squares, and
+ * the result. Recorders that only need some of the notifications can derive from this one.
+ */
+struct no_instrumentation {
+  struct recorder {
+    template<typename F>
+    recorder(const char*, const F&)
+    {
+    }
+
+    template<typename F>
+    F& wrap(F& a_f)
+    {
+      return a_f;
+    }
+    void start(propagation_stage) {}
+    void stop(propagation_stage) {}
+    void add_allocations(size_t) {}
+
+    template<typename T>
+    void on_nominal(const T&)
+    {
+    }
+    template<typename T>
+    void on_deviation(size_t, const T&)
+    {
+    }
+    template<typename T>
+    void on_correlation_term(size_t, size_t, const T&)
+    {
+    }
+    template<typename N, typename U>
+    void on_result(const N&, const U&)
+    {
+    }
+  };
+};
+
+  /**
+   * A class that provides basic error propagation through arbitrary functions.
+   *
+   * The InstrumentationPolicy is notified of each call, function evaluation, allocation,
+   * and stage of the error propagation (see instrumentation.hpp). The default policy does nothing.
+   */
+template<typename InstrumentationPolicy = no_instrumentation>
+struct instrumented_error_propagator {
+  template<typename T, size_t N>
+  using static_vector = std::array<T, N>;
+
+  using recorder_type = typename InstrumentationPolicy::recorder;
+
+  /**
+   * Propagate error through a function f.
+   *
+   * DOES NOT HANDLE CORRELATED INPUTS
+   */
+  template<typename F, typename... Args>
+  static auto propagate_error(F a_f, Args... args)
+      -> uncertain<decltype(a_f(get_nominal(args)...))>
+  {
+    recorder_type recorder("propagate_error", a_f);
+    auto&&        f = recorder.wrap(a_f);
+    // [1] Need to be careful here. It is possible that the difference between
+    // two returned values has a different type than a single return value.
+    // For example, if the function returns a type representing a quantity
+    // with a unit that has an offset (i.e. temperature in celcius: 100 C - 90 C 10 delta_C \ne 10 C)
+    static_vector<decltype(a_f(get_nominal(args)...) - a_f(get_upper(args)...)), sizeof...(Args)> deviations;
+    recorder.start(propagation_stage::evaluate);
+    auto nominal = _propagate_error(f, deviations, std::forward<Args>(args)...);
+    recorder.stop(propagation_stage::evaluate);
+    _trace_evaluation(recorder, nominal, deviations);
+    recorder.start(propagation_stage::combine);
+    auto unc = sqrt(std::inner_product(deviations.begin() + 1, deviations.end(), deviations.begin() + 1, deviations[0] * deviations[0]));
+    recorder.stop(propagation_stage::combine);
+    recorder.on_result(nominal, unc);
+    uncertain<decltype(a_f(get_nominal(args)...))> ret(nominal, unc);
+    return ret;
+  }
+
+  /**
+   * Propagate error through a function f, doing the error propagation arithmetic on raw values.
+   *
+   * The units of Boost.Units quantity<...> arguments are stripped once, the deviations and
+   * their quadrature sum are computed with plain numbers, and the unit of the result is
+   * reattached at the end. f is still called with quantities. To use, pass `tags::strip_units{}`
+   * as the first argument. f is evaluated one point at a time, there is no batched (SIMD) path.
+   *
+   * DOES NOT HANDLE CORRELATED INPUTS
+   */
+  template<typename F, typename... Args>
+  static auto propagate_error(tags::strip_units, F a_f, Args... args)
+      -> uncertain<decltype(a_f(get_nominal(args)...))>
+  {
+    using return_type = uncertain<decltype(a_f(get_nominal(args)...))>;
+    recorder_type recorder("propagate_error[strip_units]", a_f);
+    auto&&        wrapped = recorder.wrap(a_f);
+    _unit_stripped_function<std::remove_reference_t<decltype(wrapped)>, std::decay_t<decltype(get_nominal(args))>...> f{wrapped};
+    using raw_type = decltype(f(strip_unit(get_nominal(args))...));
+    static_vector<decltype(std::declval<raw_type>() - std::declval<raw_type>()), sizeof...(Args)> deviations;
+    recorder.start(propagation_stage::evaluate);
+    auto nominal = _propagate_error(f, deviations, _strip_units(args)...);
+    recorder.stop(propagation_stage::evaluate);
+    _trace_evaluation(recorder, nominal, deviations);
+    recorder.start(propagation_stage::combine);
+    auto unc = sqrt(std::inner_product(deviations.begin() + 1, deviations.end(), deviations.begin() + 1, deviations[0] * deviations[0]));
+    recorder.stop(propagation_stage::combine);
+    recorder.on_result(nominal, unc);
+    return_type result(attach_unit<typename return_type::nominal_type>(nominal),
+                       attach_unit<typename return_type::uncertainty_type>(unc));
+    return result;
+  }
+
+  /**
+   * Propagate error through a function f with a correlations passed in as a matrix.
+   */
+  template<typename F, typename CorrelationMatrixType, typename... Args>
+  static auto propagate_error(F a_f, const CorrelationMatrixType& a_correlation_matrix, Args... args)
+      -> uncertain<decltype(a_f(args.nominal()...))>
+  {
+    recorder_type recorder("propagate_error[matrix]", a_f);
+    auto&&        f = recorder.wrap(a_f);
+    // See note [1] above
+    static_vector<decltype(a_f(args.nominal()...) - a_f(args.upper()...)), sizeof...(Args)> deviations;
+    recorder.start(propagation_stage::evaluate);
+    auto nominal = _propagate_error(f, deviations, std::forward<Args>(args)...);
+    recorder.stop(propagation_stage::evaluate);
+    _trace_evaluation(recorder, nominal, deviations);
+    recorder.start(propagation_stage::combine);
+    auto sum = std::inner_product(deviations.begin() + 1, deviations.end(), deviations.begin() + 1, deviations[0] * deviations[0]);
+    for(int i = 0; i < deviations.size(); i++) {
+      for(int j = i + 1; j < deviations.size(); j++) {
+        auto term = 2 * a_correlation_matrix(i, j) * deviations[i] * deviations[j];
+        recorder.on_correlation_term(i, j, term);
+        sum += term;
+      }
+    }
+    auto unc = sqrt(sum);
+    recorder.stop(propagation_stage::combine);
+    recorder.on_result(nominal, unc);
+    uncertain<decltype(a_f(args.nominal()...))> ret(nominal, unc);
+    return ret;
+  }
+
+  /**
+   * Propagate error through a function f and returns the result with correlations.
+   *
+   * DOES NOT HANDLE CORRELATED INPUTS
+   */
+  template<typename F, typename... Args>
+  static auto propagate_error_and_correlation(F a_f, Args... args)
+      -> add_correlation_coefficient_array<uncertain<decltype(a_f(args.nominal()...))>, double>
+  {
+    recorder_type recorder("propagate_error_and_correlation", a_f);
+    auto&&        f = recorder.wrap(a_f);
+    // See note [1] above
+    static_vector<decltype(a_f(args.nominal()...) - a_f(args.upper()...)), sizeof...(Args)> deviations;
+    recorder.start(propagation_stage::evaluate);
+    auto nominal = _propagate_error(f, deviations, std::forward<Args>(args)...);
+    recorder.stop(propagation_stage::evaluate);
+    _trace_evaluation(recorder, nominal, deviations);
+    recorder.start(propagation_stage::combine);
+    auto unc = sqrt(std::inner_product(deviations.begin() + 1, deviations.end(), deviations.begin() + 1, deviations[0] * deviations[0]));
+    recorder.stop(propagation_stage::combine);
+    recorder.on_result(nominal, unc);
+    recorder.start(propagation_stage::correlate);
+    add_correlation_coefficient_array<uncertain<decltype(a_f(args.nominal()...))>, double> ret(nominal, unc);
+    ret.set_correlation_coefficient_array_size(sizeof...(Args));
+    recorder.add_allocations(1);
+    for(int i = 0; i < sizeof...(Args); ++i) {
+      ret.get_correlation_coefficients()[i] = deviations[i] / unc;
+    }
+    recorder.stop(propagation_stage::correlate);
+    return ret;
+  }
+
+  /**
+   * Propagate error through a function f with correlations and returns the result with correlations.
+   */
+  template<typename F, typename CorrelationMatrixType, typename... Args>
+  static auto propagate_error_and_correlation(F a_f, const CorrelationMatrixType& a_correlation_matrix, Args... args)
+      -> add_correlation_coefficient_array<uncertain<decltype(a_f(args.nominal()...))>, double>
+  {
+    recorder_type recorder("propagate_error_and_correlation[matrix]", a_f);
+    auto&&        f = recorder.wrap(a_f);
+    // See note [1] above
+    using deviations_type = decltype(a_f(args.nominal()...) - a_f(args.upper()...));
+    static_vector<deviations_type, sizeof...(Args)> deviations;
+    recorder.start(propagation_stage::evaluate);
+    auto nominal = _propagate_error(f, deviations, std::forward<Args>(args)...);
+    recorder.stop(propagation_stage::evaluate);
+    _trace_evaluation(recorder, nominal, deviations);
+    recorder.start(propagation_stage::combine);
+    auto sum = std::inner_product(deviations.begin() + 1, deviations.end(), deviations.begin() + 1, deviations[0] * deviations[0]);
+    for(int i = 0; i < deviations.size(); i++) {
+      for(int j = i + 1; j < deviations.size(); j++) {
+        auto term = 2 * a_correlation_matrix(i, j) * deviations[i] * deviations[j];
+        recorder.on_correlation_term(i, j, term);
+        sum += term;
+      }
+    }
+    auto unc = sqrt(sum);
+    recorder.stop(propagation_stage::combine);
+    recorder.on_result(nominal, unc);
+    recorder.start(propagation_stage::correlate);
+    add_correlation_coefficient_array<uncertain<decltype(a_f(args.nominal()...))>, double> ret(nominal, unc);
+    ret.set_correlation_coefficient_array_size(sizeof...(Args));
+    recorder.add_allocations(1);
+    for(int i = 0; i < sizeof...(Args); ++i) {
+      auto sum = deviations[i];
+      for(int j = 0; j < sizeof...(Args); ++j) {
+        if(i != j) {
+          sum += a_correlation_matrix(i, j) * deviations[j];
+        }
+      }
+      ret.get_correlation_coefficients()[i] = sum / unc;
+    }
+    recorder.stop(propagation_stage::correlate);
+    return ret;
+  }
+
+  /**
+   * Propagate error through a function f with correlations using a correlation store.
+   */
+  template<typename F, typename T, typename... Args>
+  static auto propagate_error(F a_f, correlation_store<T>& a_correlation_store, Args... args)
+      -> add_id<uncertain<decltype(a_f(args.nominal()...))>>
+  {
+    recorder_type recorder("propagate_error[store]", a_f);
+    auto&&        f = recorder.wrap(a_f);
+    // See note [1] above
+    using deviations_type = decltype(a_f(args.nominal()...) - a_f(args.upper()...));
+    using id_type         = decltype(get_uniq_id());
+
+    static_vector<deviations_type, sizeof...(Args)> deviations;
+    static_vector<id_type, sizeof...(Args)>         ids{get_id(args)...};
+
+    recorder.start(propagation_stage::evaluate);
+    auto nominal = _propagate_error(f, deviations, std::forward<Args>(args)...);
+    recorder.stop(propagation_stage::evaluate);
+    _trace_evaluation(recorder, nominal, deviations);
+
+    // compute the uncertainty
+    // start with uncorrelated terms
+    recorder.start(propagation_stage::combine);
+    auto sum     = std::inner_product(deviations.begin() + 1, deviations.end(), deviations.begin() + 1, deviations[0] * deviations[0]);
+    // add correlation terms
+    for(int i = 0; i < deviations.size(); i++) {
+      if(ids[i] == 0) {
+        continue;
+      }
+      for(int j = i + 1; j < deviations.size(); j++) {
+        if(ids[j] == 0) {
+          continue;
+        }
+        auto term = 2 * a_correlation_store.get_with_ids(ids[i], ids[j]) * deviations[i] * deviations[j];
+        recorder.on_correlation_term(i, j, term);
+        sum += term;
+      }
+    }
+    auto unc = sqrt(sum);
+    recorder.stop(propagation_stage::combine);
+    recorder.on_result(nominal, unc);
+
+    // return value
+    add_id<uncertain<decltype(a_f(args.nominal()...))>> ret(nominal, unc);
+
+    // compute correlation coefficients for the return value and add them to the store
+    // each new entry in the store is a node allocation.
+    recorder.start(propagation_stage::correlate);
+    auto store_size = a_correlation_store.size();
+    for(int i = 0; i < sizeof...(Args); ++i) {
+      auto sum = deviations[i];
+      for(int j = 0; j < sizeof...(Args); ++j) {
+        if(i != j) {
+          sum += a_correlation_store.get_with_ids(ids[i],ids[j])*deviations[j];
+        }
+      }
+      a_correlation_store.set_with_ids( ret.get_id(), ids[i], sum/unc);
+    }
+    recorder.add_allocations(a_correlation_store.size() - store_size);
+    recorder.stop(propagation_stage::correlate);
+
+    return ret;
+  }
+
+  /**
+   * Propagate error through a function f and return the uncertainty budget: the result with the
+   * contribution and sensitivity coefficient of each input (see budget.hpp).
+   *
+   * The budget is computed from the deviations that are already needed for the uncertainty, so this
+   * does not evaluate f more often than propagate_error(...) does.
+   *
+   * DOES NOT HANDLE CORRELATED INPUTS
+   */
+  template<typename F, typename... Args>
+  static auto propagate_error_budget(F a_f, Args... args)
+      -> uncertainty_budget<decltype(a_f(get_nominal(args)...)), decltype(a_f(get_nominal(args)...) - a_f(get_upper(args)...)), sizeof...(Args)>
+  {
+    recorder_type recorder("propagate_error_budget", a_f);
+    auto&&        f = recorder.wrap(a_f);
+    // See note [1] above
+    static_vector<decltype(a_f(get_nominal(args)...) - a_f(get_upper(args)...)), sizeof...(Args)> deviations;
+    recorder.start(propagation_stage::evaluate);
+    auto nominal = _propagate_error(f, deviations, std::forward<Args>(args)...);
+    recorder.stop(propagation_stage::evaluate);
+    _trace_evaluation(recorder, nominal, deviations);
+    return _make_budget(recorder, nominal, deviations, nullptr, args...);
+  }
+
+  /**
+   * Propagate error through a function f with correlations passed in as a matrix, and return the uncertainty budget.
+   */
+  template<typename F, typename CorrelationMatrixType, typename... Args>
+  static auto propagate_error_budget(F a_f, const CorrelationMatrixType& a_correlation_matrix, Args... args)
+      -> uncertainty_budget<decltype(a_f(args.nominal()...)), decltype(a_f(args.nominal()...) - a_f(args.upper()...)), sizeof...(Args)>
+  {
+    recorder_type recorder("propagate_error_budget[matrix]", a_f);
+    auto&&        f = recorder.wrap(a_f);
+    // See note [1] above
+    static_vector<decltype(a_f(args.nominal()...) - a_f(args.upper()...)), sizeof...(Args)> deviations;
+    recorder.start(propagation_stage::evaluate);
+    auto nominal = _propagate_error(f, deviations, std::forward<Args>(args)...);
+    recorder.stop(propagation_stage::evaluate);
+    _trace_evaluation(recorder, nominal, deviations);
+    return _make_budget(
+        recorder, nominal, deviations, [&a_correlation_matrix](size_t i, size_t j) { return a_correlation_matrix(i, j); }, args...);
+  }
+
+  /**
+   * Propagate error through a function f with correlations from a correlation store, and return the uncertainty budget.
+   *
+   * The budget's result does not have an id, so nothing is added to the store.
+   */
+  template<typename F, typename T, typename... Args>
+  static auto propagate_error_budget(F a_f, const correlation_store<T>& a_correlation_store, Args... args)
+      -> uncertainty_budget<decltype(a_f(args.nominal()...)), decltype(a_f(args.nominal()...) - a_f(args.upper()...)), sizeof...(Args)>
+  {
+    using id_type = decltype(get_uniq_id());
+    recorder_type recorder("propagate_error_budget[store]", a_f);
+    auto&&        f = recorder.wrap(a_f);
+    // See note [1] above
+    static_vector<decltype(a_f(args.nominal()...) - a_f(args.upper()...)), sizeof...(Args)> deviations;
+    static_vector<id_type, sizeof...(Args)>                                                  ids{get_id(args)...};
+    recorder.start(propagation_stage::evaluate);
+    auto nominal = _propagate_error(f, deviations, std::forward<Args>(args)...);
+    recorder.stop(propagation_stage::evaluate);
+    _trace_evaluation(recorder, nominal, deviations);
+    return _make_budget(
+        recorder, nominal, deviations,
+        [&a_correlation_store, &ids](size_t i, size_t j) { return ids[i] == 0 || ids[j] == 0 ? T(0) : a_correlation_store.get_with_ids(ids[i], ids[j]); },
+        args...);
+  }
+
+ private:
+  // pass the nominal value and the deviations to the recorder's trace hooks.
+  template<typename N, typename T, size_t M>
+  static void _trace_evaluation(recorder_type& a_recorder, const N& a_nominal, const static_vector<T, M>& a_deviations)
+  {
+    a_recorder.on_nominal(a_nominal);
+    for(size_t i = 0; i < M; ++i) {
+      a_recorder.on_deviation(i, a_deviations[i]);
+    }
+  }
+
+  // combine the deviations into an uncertainty budget. a_rho(i,j) returns the correlation coefficient of inputs i and j,
+  // or is nullptr for uncorrelated inputs.
+  template<typename N, typename T, size_t M, typename Rho, typename... Args>
+  static auto _make_budget(recorder_type& a_recorder, const N& a_nominal, const static_vector<T, M>& a_deviations, Rho a_rho, const Args&... args)
+  {
+    uncertainty_budget<N, T, M> budget;
+    static_vector<double, M>    input_uncertainties{static_cast<double>(strip_unit(get_uncertainty(args)))...};
+
+    a_recorder.start(propagation_stage::combine);
+    auto sum = std::inner_product(a_deviations.begin() + 1, a_deviations.end(), a_deviations.begin() + 1, a_deviations[0] * a_deviations[0]);
+    for(size_t i = 0; i < M; ++i) {
+      budget.correlation_terms[i].fill(zero<typename uncertainty_budget<N, T, M>::variance_type>());
+    }
+    if constexpr(!std::is_same_v<Rho, std::nullptr_t>) {
+      for(size_t i = 0; i < M; ++i) {
+        for(size_t j = i + 1; j < M; ++j) {
+          auto term                      = a_rho(i, j) * a_deviations[i] * a_deviations[j];
+          budget.correlation_terms[i][j] = term;
+          budget.correlation_terms[j][i] = term;
+          a_recorder.on_correlation_term(i, j, 2 * term);
+          sum += 2 * term;
+        }
+      }
+    }
+    auto unc = sqrt(sum);
+    a_recorder.stop(propagation_stage::combine);
+    a_recorder.on_result(a_nominal, unc);
+
+    budget.result = uncertain<N>(a_nominal, unc);
+    for(size_t i = 0; i < M; ++i) {
+      budget.contributions[i] = a_deviations[i];
+      budget.sensitivities[i] = input_uncertainties[i] != 0 ? static_cast<double>(strip_unit(a_deviations[i])) / input_uncertainties[i] : 0.;
+    }
+    return budget;
+  }
+
+  // wraps a function so that it takes and returns raw values. the arguments are converted to the
+  // types in Args before calling the function.
+  template<typename F, typename... Args>
+  struct _unit_stripped_function {
+    F& f;
+
+    template<typename... Vals>
+    auto operator()(Vals... vals) const -> decltype(strip_unit(f(attach_unit<Args>(vals)...)))
+    {
+      return strip_unit(f(attach_unit<Args>(vals)...));
+    }
+  };
+
+  // strip the unit from an argument, keeping the (upper - nominal) uncertainty for uncertain arguments.
+  template<typename A>
+  static auto _strip_units(const A& a_arg)
+  {
+    if constexpr(is_uncertain<A>(priority<2>{})) {
+      auto nom = strip_unit(get_nominal(a_arg));
+      return uncertain<decltype(nom)>(nom, strip_unit(get_upper(a_arg)) - nom);
+    } else {
+      return strip_unit(a_arg);
+    }
+  }
+
+// BEGIN GENERATED CODE
+// this code was generated using the generate_basic_error_propagator_propagate_error_templates.py script
+// to delete this code, you can run (in vim) :g/^\s*\/\/ BEGIN GENERATED CODE/,/^\s*\/\/ END GENERATED CODE/ d
+// to reinsert it, you can run (in vim) :.! python scripts/generate_basic_error_propagator_propagate_error_templates.py
+// I'm sorry this is so old-school, but your debugger will thank me...
+template<typename F, typename T,
+typename A0
+>
+static auto _propagate_error(F a_f,
+static_vector<T,1>& a_deviations,
+const A0& a_a0
+)
+{
+auto nominal = a_f( get_nominal(a_a0));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1
+>
+static auto _propagate_error(F a_f,
+static_vector<T,2>& a_deviations,
+const A0& a_a0,
+const A1& a_a1
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2
+>
+static auto _propagate_error(F a_f,
+static_vector<T,3>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3
+>
+static auto _propagate_error(F a_f,
+static_vector<T,4>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4
+>
+static auto _propagate_error(F a_f,
+static_vector<T,5>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5
+>
+static auto _propagate_error(F a_f,
+static_vector<T,6>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6
+>
+static auto _propagate_error(F a_f,
+static_vector<T,7>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7
+>
+static auto _propagate_error(F a_f,
+static_vector<T,8>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8
+>
+static auto _propagate_error(F a_f,
+static_vector<T,9>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9
+>
+static auto _propagate_error(F a_f,
+static_vector<T,10>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9,
+typename A10
+>
+static auto _propagate_error(F a_f,
+static_vector<T,11>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9,
+const A10& a_a10
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9), get_nominal(a_a10)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9), get_nominal(a_a10)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a10) ) {
+a_deviations[10]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_upper(a_a10)) - nominal;
+}else{
+a_deviations[10] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9,
+typename A10,
+typename A11
+>
+static auto _propagate_error(F a_f,
+static_vector<T,12>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9,
+const A10& a_a10,
+const A11& a_a11
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9), get_nominal(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a10) ) {
+a_deviations[10]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_upper(a_a10), get_nominal(a_a11)) - nominal;
+}else{
+a_deviations[10] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a11) ) {
+a_deviations[11]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_upper(a_a11)) - nominal;
+}else{
+a_deviations[11] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9,
+typename A10,
+typename A11,
+typename A12
+>
+static auto _propagate_error(F a_f,
+static_vector<T,13>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9,
+const A10& a_a10,
+const A11& a_a11,
+const A12& a_a12
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a10) ) {
+a_deviations[10]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_upper(a_a10), get_nominal(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[10] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a11) ) {
+a_deviations[11]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_upper(a_a11), get_nominal(a_a12)) - nominal;
+}else{
+a_deviations[11] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a12) ) {
+a_deviations[12]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_upper(a_a12)) - nominal;
+}else{
+a_deviations[12] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9,
+typename A10,
+typename A11,
+typename A12,
+typename A13
+>
+static auto _propagate_error(F a_f,
+static_vector<T,14>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9,
+const A10& a_a10,
+const A11& a_a11,
+const A12& a_a12,
+const A13& a_a13
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a10) ) {
+a_deviations[10]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_upper(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[10] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a11) ) {
+a_deviations[11]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_upper(a_a11), get_nominal(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[11] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a12) ) {
+a_deviations[12]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_upper(a_a12), get_nominal(a_a13)) - nominal;
+}else{
+a_deviations[12] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a13) ) {
+a_deviations[13]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_upper(a_a13)) - nominal;
+}else{
+a_deviations[13] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9,
+typename A10,
+typename A11,
+typename A12,
+typename A13,
+typename A14
+>
+static auto _propagate_error(F a_f,
+static_vector<T,15>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9,
+const A10& a_a10,
+const A11& a_a11,
+const A12& a_a12,
+const A13& a_a13,
+const A14& a_a14
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a10) ) {
+a_deviations[10]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_upper(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[10] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a11) ) {
+a_deviations[11]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_upper(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[11] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a12) ) {
+a_deviations[12]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_upper(a_a12), get_nominal(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[12] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a13) ) {
+a_deviations[13]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_upper(a_a13), get_nominal(a_a14)) - nominal;
+}else{
+a_deviations[13] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a14) ) {
+a_deviations[14]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_upper(a_a14)) - nominal;
+}else{
+a_deviations[14] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9,
+typename A10,
+typename A11,
+typename A12,
+typename A13,
+typename A14,
+typename A15
+>
+static auto _propagate_error(F a_f,
+static_vector<T,16>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9,
+const A10& a_a10,
+const A11& a_a11,
+const A12& a_a12,
+const A13& a_a13,
+const A14& a_a14,
+const A15& a_a15
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a10) ) {
+a_deviations[10]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_upper(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[10] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a11) ) {
+a_deviations[11]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_upper(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[11] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a12) ) {
+a_deviations[12]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_upper(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[12] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a13) ) {
+a_deviations[13]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_upper(a_a13), get_nominal(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[13] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a14) ) {
+a_deviations[14]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_upper(a_a14), get_nominal(a_a15)) - nominal;
+}else{
+a_deviations[14] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a15) ) {
+a_deviations[15]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_upper(a_a15)) - nominal;
+}else{
+a_deviations[15] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9,
+typename A10,
+typename A11,
+typename A12,
+typename A13,
+typename A14,
+typename A15,
+typename A16
+>
+static auto _propagate_error(F a_f,
+static_vector<T,17>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9,
+const A10& a_a10,
+const A11& a_a11,
+const A12& a_a12,
+const A13& a_a13,
+const A14& a_a14,
+const A15& a_a15,
+const A16& a_a16
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a10) ) {
+a_deviations[10]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_upper(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[10] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a11) ) {
+a_deviations[11]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_upper(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[11] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a12) ) {
+a_deviations[12]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_upper(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[12] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a13) ) {
+a_deviations[13]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_upper(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[13] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a14) ) {
+a_deviations[14]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_upper(a_a14), get_nominal(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[14] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a15) ) {
+a_deviations[15]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_upper(a_a15), get_nominal(a_a16)) - nominal;
+}else{
+a_deviations[15] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a16) ) {
+a_deviations[16]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_upper(a_a16)) - nominal;
+}else{
+a_deviations[16] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9,
+typename A10,
+typename A11,
+typename A12,
+typename A13,
+typename A14,
+typename A15,
+typename A16,
+typename A17
+>
+static auto _propagate_error(F a_f,
+static_vector<T,18>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9,
+const A10& a_a10,
+const A11& a_a11,
+const A12& a_a12,
+const A13& a_a13,
+const A14& a_a14,
+const A15& a_a15,
+const A16& a_a16,
+const A17& a_a17
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a10) ) {
+a_deviations[10]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_upper(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[10] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a11) ) {
+a_deviations[11]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_upper(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[11] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a12) ) {
+a_deviations[12]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_upper(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[12] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a13) ) {
+a_deviations[13]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_upper(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[13] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a14) ) {
+a_deviations[14]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_upper(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[14] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a15) ) {
+a_deviations[15]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_upper(a_a15), get_nominal(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[15] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a16) ) {
+a_deviations[16]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_upper(a_a16), get_nominal(a_a17)) - nominal;
+}else{
+a_deviations[16] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a17) ) {
+a_deviations[17]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_upper(a_a17)) - nominal;
+}else{
+a_deviations[17] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9,
+typename A10,
+typename A11,
+typename A12,
+typename A13,
+typename A14,
+typename A15,
+typename A16,
+typename A17,
+typename A18
+>
+static auto _propagate_error(F a_f,
+static_vector<T,19>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9,
+const A10& a_a10,
+const A11& a_a11,
+const A12& a_a12,
+const A13& a_a13,
+const A14& a_a14,
+const A15& a_a15,
+const A16& a_a16,
+const A17& a_a17,
+const A18& a_a18
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a10) ) {
+a_deviations[10]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_upper(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[10] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a11) ) {
+a_deviations[11]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_upper(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[11] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a12) ) {
+a_deviations[12]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_upper(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[12] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a13) ) {
+a_deviations[13]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_upper(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[13] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a14) ) {
+a_deviations[14]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_upper(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[14] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a15) ) {
+a_deviations[15]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_upper(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[15] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a16) ) {
+a_deviations[16]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_upper(a_a16), get_nominal(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[16] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a17) ) {
+a_deviations[17]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_upper(a_a17), get_nominal(a_a18)) - nominal;
+}else{
+a_deviations[17] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a18) ) {
+a_deviations[18]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_upper(a_a18)) - nominal;
+}else{
+a_deviations[18] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+template<typename F, typename T,
+typename A0,
+typename A1,
+typename A2,
+typename A3,
+typename A4,
+typename A5,
+typename A6,
+typename A7,
+typename A8,
+typename A9,
+typename A10,
+typename A11,
+typename A12,
+typename A13,
+typename A14,
+typename A15,
+typename A16,
+typename A17,
+typename A18,
+typename A19
+>
+static auto _propagate_error(F a_f,
+static_vector<T,20>& a_deviations,
+const A0& a_a0,
+const A1& a_a1,
+const A2& a_a2,
+const A3& a_a3,
+const A4& a_a4,
+const A5& a_a5,
+const A6& a_a6,
+const A7& a_a7,
+const A8& a_a8,
+const A9& a_a9,
+const A10& a_a10,
+const A11& a_a11,
+const A12& a_a12,
+const A13& a_a13,
+const A14& a_a14,
+const A15& a_a15,
+const A16& a_a16,
+const A17& a_a17,
+const A18& a_a18,
+const A19& a_a19
+)
+{
+auto nominal = a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19));
+if( is_uncertain(a_a0) ) {
+a_deviations[0]= a_f( get_upper(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[0] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a1) ) {
+a_deviations[1]= a_f( get_nominal(a_a0), get_upper(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[1] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a2) ) {
+a_deviations[2]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_upper(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[2] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a3) ) {
+a_deviations[3]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_upper(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[3] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a4) ) {
+a_deviations[4]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_upper(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[4] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a5) ) {
+a_deviations[5]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_upper(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[5] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a6) ) {
+a_deviations[6]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_upper(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[6] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a7) ) {
+a_deviations[7]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_upper(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[7] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a8) ) {
+a_deviations[8]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_upper(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[8] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a9) ) {
+a_deviations[9]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_upper(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[9] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a10) ) {
+a_deviations[10]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_upper(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[10] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a11) ) {
+a_deviations[11]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_upper(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[11] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a12) ) {
+a_deviations[12]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_upper(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[12] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a13) ) {
+a_deviations[13]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_upper(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[13] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a14) ) {
+a_deviations[14]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_upper(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[14] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a15) ) {
+a_deviations[15]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_upper(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[15] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a16) ) {
+a_deviations[16]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_upper(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[16] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a17) ) {
+a_deviations[17]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_upper(a_a17), get_nominal(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[17] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a18) ) {
+a_deviations[18]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_upper(a_a18), get_nominal(a_a19)) - nominal;
+}else{
+a_deviations[18] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+if( is_uncertain(a_a19) ) {
+a_deviations[19]= a_f( get_nominal(a_a0), get_nominal(a_a1), get_nominal(a_a2), get_nominal(a_a3), get_nominal(a_a4), get_nominal(a_a5), get_nominal(a_a6), get_nominal(a_a7), get_nominal(a_a8), get_nominal(a_a9), get_nominal(a_a10), get_nominal(a_a11), get_nominal(a_a12), get_nominal(a_a13), get_nominal(a_a14), get_nominal(a_a15), get_nominal(a_a16), get_nominal(a_a17), get_nominal(a_a18), get_upper(a_a19)) - nominal;
+}else{
+a_deviations[19] = zero<T>(); // can't just use 0 here, we might be dealing with quantities that have units
+}
+return nominal;
+}
+
+// END GENERATED CODE
+};
+
+using basic_error_propagator = instrumented_error_propagator<no_instrumentation>;
+
+}  // namespace libUncertainty
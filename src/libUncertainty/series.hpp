@@ -0,0 +1,402 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./uncertain_core.hpp"
+#include "./utils.hpp"
+
+/** @file series.hpp
+ * @brief O(N) operations on series of uncertain values (sums, integrals, derivatives), with the correlations they introduce.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+/**
+ * A symmetric, banded covariance matrix. Element (i,j) is zero if |i - j| > bandwidth.
+ *
+ * Only the diagonal and the upper bands are stored (N*(bandwidth+1) values), so the
+ * covariance of a long series produced by a local operation (a finite difference, one
+ * step of an integral, ...) takes O(N) memory instead of O(N^2).
+ *
+ * Elements are in the (stripped) units of the series.
+ */
+class banded_covariance
+{
+ public:
+  banded_covariance() = default;
+  banded_covariance(size_t a_N, size_t a_bandwidth) : m_N(a_N), m_bandwidth(a_bandwidth), m_elements(a_N * (a_bandwidth + 1), 0.) {}
+
+  size_t size() const { return m_N; }
+  size_t bandwidth() const { return m_bandwidth; }
+
+  double operator()(size_t a_i, size_t a_j) const
+  {
+    if(a_i > a_j) {
+      std::swap(a_i, a_j);
+    }
+    return a_j - a_i > m_bandwidth ? 0. : m_elements[a_i * (m_bandwidth + 1) + (a_j - a_i)];
+  }
+  double& operator()(size_t a_i, size_t a_j)
+  {
+    if(a_i > a_j) {
+      std::swap(a_i, a_j);
+    }
+    if(a_j - a_i > m_bandwidth) {
+      throw std::out_of_range("banded_covariance: element is outside of the band.");
+    }
+    return m_elements[a_i * (m_bandwidth + 1) + (a_j - a_i)];
+  }
+
+  double variance(size_t a_i) const { return (*this)(a_i, a_i); }
+  double correlation(size_t a_i, size_t a_j) const
+  {
+    double norm = std::sqrt(variance(a_i) * variance(a_j));
+    return norm > 0 ? (*this)(a_i, a_j) / norm : 0.;
+  }
+
+ private:
+  size_t              m_N         = 0;
+  size_t              m_bandwidth = 0;
+  std::vector<double> m_elements;
+};
+
+/**
+ * The covariance of a cumulative series (a running sum or integral), C_i = d_0 + ... + d_i.
+ *
+ * The cumulative values are strongly correlated (each one contains all of the previous ones), so
+ * their covariance is dense. But the increments d_i have a banded covariance, and
+ * cov(C_i, C_j) = var(C_i) + sum_{a <= i < b <= j} cov(d_a, d_b) for i <= j, which only involves
+ * the increments within one bandwidth of i. So the full covariance is stored in O(N) memory,
+ * and each element is computed in O(bandwidth^2).
+ *
+ * Elements are in the (stripped) units of the series.
+ */
+class cumulative_covariance
+{
+ public:
+  cumulative_covariance() = default;
+  cumulative_covariance(banded_covariance a_increments) : m_increments(std::move(a_increments)), m_variance(m_increments.size())
+  {
+    // var(C_i) = var(C_{i-1}) + var(d_i) + 2 cov(C_{i-1}, d_i)
+    size_t B = m_increments.bandwidth();
+    for(size_t i = 0; i < m_variance.size(); ++i) {
+      double v = m_increments(i, i);
+      for(size_t a = i > B ? i - B : 0; a < i; ++a) {
+        v += 2 * m_increments(a, i);
+      }
+      m_variance[i] = (i > 0 ? m_variance[i - 1] : 0.) + v;
+    }
+  }
+
+  size_t size() const { return m_variance.size(); }
+
+  double operator()(size_t a_i, size_t a_j) const
+  {
+    if(a_i > a_j) {
+      std::swap(a_i, a_j);
+    }
+    size_t B   = m_increments.bandwidth();
+    double cov = m_variance[a_i];
+    for(size_t a = a_i + 1 > B ? a_i + 1 - B : 0; a <= a_i; ++a) {
+      for(size_t b = a_i + 1; b <= std::min(a_j, a + B); ++b) {
+        cov += m_increments(a, b);
+      }
+    }
+    return cov;
+  }
+
+  double variance(size_t a_i) const { return m_variance[a_i]; }
+  double correlation(size_t a_i, size_t a_j) const
+  {
+    double norm = std::sqrt(variance(a_i) * variance(a_j));
+    return norm > 0 ? (*this)(a_i, a_j) / norm : 0.;
+  }
+
+  /**
+   * The (banded) covariance of the increments, C_i - C_{i-1}.
+   */
+  const banded_covariance& increments() const { return m_increments; }
+
+ private:
+  banded_covariance   m_increments;
+  std::vector<double> m_variance;
+};
+
+namespace detail
+{
+// the nominal values and uncertainties of a series, with the units stripped, in contiguous arrays
+// so that the kernels below vectorize.
+struct raw_series {
+  std::vector<double> nominal, sigma;
+
+  template<typename Iterator>
+  void assign(Iterator a_begin, Iterator a_end)
+  {
+    for(auto it = a_begin; it != a_end; ++it) {
+      nominal.push_back(static_cast<double>(strip_unit(get_nominal(*it))));
+      sigma.push_back(static_cast<double>(strip_unit(get_uncertainty(*it))));
+    }
+  }
+  template<typename Iterator>
+  void assign_nominal(Iterator a_begin, size_t a_N)
+  {
+    nominal.resize(a_N);
+    auto it = a_begin;
+    for(size_t i = 0; i < a_N; ++i, ++it) {
+      nominal[i] = static_cast<double>(strip_unit(get_nominal(*it)));
+    }
+  }
+  size_t size() const { return nominal.size(); }
+};
+
+template<typename Iterator>
+using series_nominal_type = std::decay_t<decltype(get_nominal(*std::declval<Iterator>()))>;
+template<typename XIterator, typename YIterator>
+using integral_type = decltype(std::declval<series_nominal_type<YIterator>>() * std::declval<series_nominal_type<XIterator>>());
+
+// the integral sum_i w_i y_i of a series with independent uncertainties.
+template<typename T>
+uncertain<T> weighted_sum(const std::vector<double>& a_w, const raw_series& a_y)
+{
+  const double* w   = a_w.data();
+  const double* y   = a_y.nominal.data();
+  const double* s   = a_y.sigma.data();
+  double        sum = 0, var = 0;
+  for(size_t i = 0; i < a_w.size(); ++i) {
+    sum += w[i] * y[i];
+    var += w[i] * w[i] * s[i] * s[i];
+  }
+  return uncertain<T>(attach_unit<T>(sum), attach_unit<T>(std::sqrt(var)));
+}
+
+template<typename XIterator, typename YIterator>
+using derivative_type = decltype(std::declval<series_nominal_type<YIterator>>() / std::declval<series_nominal_type<XIterator>>());
+
+// the difference quotient (y_b - y_a) / (x_b - x_a)
+struct difference_stencil {
+  size_t a, b;
+  double w;  // 1 / (x_b - x_a)
+};
+
+// evaluate a set of difference quotients of a series, and the (banded) covariance between them.
+template<typename T, typename OutputIterator>
+OutputIterator apply_stencils(const std::vector<difference_stencil>& a_stencils, const raw_series& a_y, size_t a_bandwidth, OutputIterator a_out,
+                              banded_covariance* a_covariance)
+{
+  size_t              M = a_stencils.size();
+  std::vector<double> value(M), variance(M);
+  for(size_t i = 0; i < M; ++i) {
+    const auto& s = a_stencils[i];
+    value[i]      = s.w * (a_y.nominal[s.b] - a_y.nominal[s.a]);
+    variance[i]   = s.w * s.w * (a_y.sigma[s.a] * a_y.sigma[s.a] + a_y.sigma[s.b] * a_y.sigma[s.b]);
+  }
+  for(size_t i = 0; i < M; ++i) {
+    *a_out++ = uncertain<T>(attach_unit<T>(value[i]), attach_unit<T>(std::sqrt(variance[i])));
+  }
+  if(a_covariance) {
+    *a_covariance = banded_covariance(M, a_bandwidth);
+    for(size_t i = 0; i < M; ++i) {
+      (*a_covariance)(i, i) = variance[i];
+      for(size_t j = i + 1; j < std::min(M, i + a_bandwidth + 1); ++j) {
+        // the quotients are correlated through the points they share, +y_b and -y_a
+        const auto& si  = a_stencils[i];
+        const auto& sj  = a_stencils[j];
+        double      cov = 0;
+        for(auto [ki, ci] : {std::pair{si.a, -si.w}, std::pair{si.b, si.w}}) {
+          for(auto [kj, cj] : {std::pair{sj.a, -sj.w}, std::pair{sj.b, sj.w}}) {
+            if(ki == kj) {
+              cov += ci * cj * a_y.sigma[ki] * a_y.sigma[ki];
+            }
+          }
+        }
+        (*a_covariance)(i, j) = cov;
+      }
+    }
+  }
+  return a_out;
+}
+}  // namespace detail
+
+/**
+ * Compute the running sum of a series of uncertain values, C_i = y_0 + ... + y_i, and write it to a_out.
+ *
+ * This is O(N). The running sums are correlated, if a_covariance is given it is set to their covariance.
+ *
+ * DOES NOT HANDLE CORRELATED INPUTS
+ */
+template<typename YIterator, typename OutputIterator>
+OutputIterator cumulative_sum(YIterator a_y_begin, YIterator a_y_end, OutputIterator a_out, cumulative_covariance* a_covariance = nullptr)
+{
+  using T = detail::series_nominal_type<YIterator>;
+  detail::raw_series y;
+  y.assign(a_y_begin, a_y_end);
+  banded_covariance increments(y.size(), 0);
+  double            sum = 0, var = 0;
+  for(size_t i = 0; i < y.size(); ++i) {
+    sum += y.nominal[i];
+    var += y.sigma[i] * y.sigma[i];
+    increments(i, i) = y.sigma[i] * y.sigma[i];
+    *a_out++         = uncertain<T>(attach_unit<T>(sum), attach_unit<T>(std::sqrt(var)));
+  }
+  if(a_covariance) {
+    *a_covariance = cumulative_covariance(std::move(increments));
+  }
+  return a_out;
+}
+
+/**
+ * Integrate a sampled series y(x) with the trapezoid rule.
+ *
+ * x may be unevenly spaced. The uncertainty in x is ignored. This is O(N) (the direct approach,
+ * propagating error through the integral as a function of N inputs, is O(N^2)).
+ *
+ * DOES NOT HANDLE CORRELATED INPUTS
+ */
+template<typename XIterator, typename YIterator>
+auto trapezoid(XIterator a_x_begin, XIterator a_x_end, YIterator a_y_begin) -> uncertain<detail::integral_type<XIterator, YIterator>>
+{
+  detail::raw_series x, y;
+  x.assign_nominal(a_x_begin, std::distance(a_x_begin, a_x_end));
+  y.assign(a_y_begin, std::next(a_y_begin, x.size()));
+  // the weight of each point is half of the width of the intervals on either side of it
+  std::vector<double> w(x.size(), 0.);
+  for(size_t i = 0; i + 1 < x.size(); ++i) {
+    double half = (x.nominal[i + 1] - x.nominal[i]) / 2;
+    w[i] += half;
+    w[i + 1] += half;
+  }
+  return detail::weighted_sum<detail::integral_type<XIterator, YIterator>>(w, y);
+}
+
+/**
+ * Compute the running integral of a sampled series y(x) with the trapezoid rule, and write it to a_out.
+ *
+ * The first value is zero. The running integrals are correlated, if a_covariance is given it is set to
+ * their covariance (neighboring steps share a point, so the increments have a bandwidth of one).
+ *
+ * DOES NOT HANDLE CORRELATED INPUTS
+ */
+template<typename XIterator, typename YIterator, typename OutputIterator>
+OutputIterator cumulative_trapezoid(XIterator a_x_begin, XIterator a_x_end, YIterator a_y_begin, OutputIterator a_out, cumulative_covariance* a_covariance = nullptr)
+{
+  using T = detail::integral_type<XIterator, YIterator>;
+  detail::raw_series x, y;
+  x.assign_nominal(a_x_begin, std::distance(a_x_begin, a_x_end));
+  y.assign(a_y_begin, std::next(a_y_begin, x.size()));
+  size_t            N = x.size();
+  banded_covariance increments(N, 1);
+  double            sum = 0, var = 0, previous_half = 0;
+  for(size_t i = 0; i < N; ++i) {
+    if(i > 0) {
+      // d_i = (x_i - x_{i-1}) (y_{i-1} + y_i) / 2
+      double half      = (x.nominal[i] - x.nominal[i - 1]) / 2;
+      double s0        = y.sigma[i - 1] * y.sigma[i - 1];
+      double s1        = y.sigma[i] * y.sigma[i];
+      increments(i, i) = half * half * (s0 + s1);
+      // d_{i-1} and d_i share y_{i-1}
+      increments(i - 1, i) = previous_half * half * s0;
+      sum += half * (y.nominal[i - 1] + y.nominal[i]);
+      var += increments(i, i) + 2 * increments(i - 1, i);
+      previous_half = half;
+    }
+    *a_out++ = uncertain<T>(attach_unit<T>(sum), attach_unit<T>(std::sqrt(var)));
+  }
+  if(a_covariance) {
+    *a_covariance = cumulative_covariance(std::move(increments));
+  }
+  return a_out;
+}
+
+/**
+ * Integrate a sampled series y(x) with Simpson's rule.
+ *
+ * x may be unevenly spaced, but there must be an odd number of points (an even number of intervals).
+ * The uncertainty in x is ignored. This is O(N).
+ *
+ * DOES NOT HANDLE CORRELATED INPUTS
+ */
+template<typename XIterator, typename YIterator>
+auto simpson(XIterator a_x_begin, XIterator a_x_end, YIterator a_y_begin) -> uncertain<detail::integral_type<XIterator, YIterator>>
+{
+  detail::raw_series x, y;
+  x.assign_nominal(a_x_begin, std::distance(a_x_begin, a_x_end));
+  y.assign(a_y_begin, std::next(a_y_begin, x.size()));
+  if(x.size() < 3 || x.size() % 2 == 0) {
+    throw std::invalid_argument("simpson: an odd number of points (at least three) is required.");
+  }
+  // the weights of each panel of two intervals, h0 and h1
+  std::vector<double> w(x.size(), 0.);
+  for(size_t i = 0; i + 2 < x.size(); i += 2) {
+    double h0 = x.nominal[i + 1] - x.nominal[i];
+    double h1 = x.nominal[i + 2] - x.nominal[i + 1];
+    double c  = (h0 + h1) / 6;
+    w[i] += c * (2 - h1 / h0);
+    w[i + 1] += c * (h0 + h1) * (h0 + h1) / (h0 * h1);
+    w[i + 2] += c * (2 - h0 / h1);
+  }
+  return detail::weighted_sum<detail::integral_type<XIterator, YIterator>>(w, y);
+}
+
+/**
+ * Compute the derivative of a sampled series y(x) with forward differences, (y_{i+1} - y_i) / (x_{i+1} - x_i),
+ * and write the N-1 values to a_out.
+ *
+ * Neighboring differences share a point, so they are (anti-)correlated. If a_covariance is given it is set to
+ * their covariance, which has a bandwidth of one. The uncertainty in x is ignored. This is O(N).
+ *
+ * DOES NOT HANDLE CORRELATED INPUTS
+ */
+template<typename XIterator, typename YIterator, typename OutputIterator>
+OutputIterator forward_difference(XIterator a_x_begin, XIterator a_x_end, YIterator a_y_begin, OutputIterator a_out, banded_covariance* a_covariance = nullptr)
+{
+  detail::raw_series x, y;
+  x.assign_nominal(a_x_begin, std::distance(a_x_begin, a_x_end));
+  y.assign(a_y_begin, std::next(a_y_begin, x.size()));
+  if(x.size() < 2) {
+    throw std::invalid_argument("forward_difference: at least two points are required.");
+  }
+  std::vector<detail::difference_stencil> stencils(x.size() - 1);
+  for(size_t i = 0; i + 1 < x.size(); ++i) {
+    stencils[i] = {i, i + 1, 1 / (x.nominal[i + 1] - x.nominal[i])};
+  }
+  return detail::apply_stencils<detail::derivative_type<XIterator, YIterator>>(stencils, y, 1, a_out, a_covariance);
+}
+
+/**
+ * Compute the derivative of a sampled series y(x) with central differences, (y_{i+1} - y_{i-1}) / (x_{i+1} - x_{i-1}),
+ * and write the N values to a_out. The first and last points use forward and backward differences.
+ *
+ * Differences two points apart share a point, so they are correlated. If a_covariance is given it is set to
+ * their covariance, which has a bandwidth of two. The uncertainty in x is ignored. This is O(N).
+ *
+ * DOES NOT HANDLE CORRELATED INPUTS
+ */
+template<typename XIterator, typename YIterator, typename OutputIterator>
+OutputIterator central_difference(XIterator a_x_begin, XIterator a_x_end, YIterator a_y_begin, OutputIterator a_out, banded_covariance* a_covariance = nullptr)
+{
+  detail::raw_series x, y;
+  x.assign_nominal(a_x_begin, std::distance(a_x_begin, a_x_end));
+  y.assign(a_y_begin, std::next(a_y_begin, x.size()));
+  size_t N = x.size();
+  if(N < 2) {
+    throw std::invalid_argument("central_difference: at least two points are required.");
+  }
+  std::vector<detail::difference_stencil> stencils(N);
+  for(size_t i = 0; i < N; ++i) {
+    size_t a    = i > 0 ? i - 1 : 0;
+    size_t b    = i + 1 < N ? i + 1 : N - 1;
+    stencils[i] = {a, b, 1 / (x.nominal[b] - x.nominal[a])};
+  }
+  return detail::apply_stencils<detail::derivative_type<XIterator, YIterator>>(stencils, y, 2, a_out, a_covariance);
+}
+
+}  // namespace libUncertainty
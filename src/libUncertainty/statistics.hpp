@@ -1,7 +1,9 @@
 #pragma once
-#include <algorithm>
 #include <iterator>
 #include <numeric>
+#ifdef LIBUNCERTAINTY_EXTERN_TEMPLATES
+#include <vector>
+#endif
 
 #include "./utils.hpp"
 
@@ -101,4 +103,16 @@ double z_score(const T1& a_a, const T2& a_b)
   return abs(get_nominal(a_a) - get_nominal(a_b)) / sqrt(a_unc * a_unc + b_unc * b_unc);
 }
 
+
+#ifdef LIBUNCERTAINTY_EXTERN_TEMPLATES
+extern template double average<std::vector<double>::iterator>(std::vector<double>::iterator, std::vector<double>::iterator);
+extern template double average<std::vector<double>::const_iterator>(std::vector<double>::const_iterator, std::vector<double>::const_iterator);
+extern template double variance<std::vector<double>::iterator>(std::vector<double>::iterator, std::vector<double>::iterator, size_t);
+extern template double variance<std::vector<double>::const_iterator>(std::vector<double>::const_iterator, std::vector<double>::const_iterator, size_t);
+extern template double standard_deviation<std::vector<double>::iterator>(std::vector<double>::iterator, std::vector<double>::iterator, size_t);
+extern template double standard_deviation<std::vector<double>::const_iterator>(std::vector<double>::const_iterator, std::vector<double>::const_iterator, size_t);
+extern template double standard_error_of_the_mean<std::vector<double>::iterator>(std::vector<double>::iterator, std::vector<double>::iterator);
+extern template double standard_error_of_the_mean<std::vector<double>::const_iterator>(std::vector<double>::const_iterator, std::vector<double>::const_iterator);
+#endif
+
 }  // namespace libUncertainty
@@ -10,5 +10,6 @@
 namespace libUncertainty {
   namespace tags {
     struct use_stdev_for_error {};
+    struct strip_units {};
   }
 }
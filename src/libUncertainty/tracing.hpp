@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+#include "./propagate_core.hpp"
+#include "./utils.hpp"
+
+/** @file tracing.hpp
+ * @brief A tracing instrumentation policy that records the intermediate values of error propagation in a ring buffer.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace libUncertainty
+{
+enum class trace_event_kind { nominal = 0, deviation = 1, correlation_term = 2, result = 3 };
+
+/**
+ * One intermediate value of an error propagation call.
+ *
+ * Values with units are stored as raw values (see strip_unit(...)). For deviations, i is the
+ * index of the argument. For correlation terms, i and j are the indices of the two arguments
+ * and value is the term 2 * rho_ij * deviation_i * deviation_j that was added to the sum of squares.
+ * For results, value is the nominal value and uncertainty is the propagated uncertainty.
+ */
+struct trace_event {
+  trace_event_kind kind        = trace_event_kind::nominal;
+  const char*      overload    = "";
+  size_t           call        = 0;
+  size_t           i           = 0;
+  size_t           j           = 0;
+  double           value       = 0;
+  double           uncertainty = 0;
+};
+
+inline const char* to_string(trace_event_kind a_kind)
+{
+  switch(a_kind) {
+    case trace_event_kind::nominal:
+      return "nominal";
+    case trace_event_kind::deviation:
+      return "deviation";
+    case trace_event_kind::correlation_term:
+      return "correlation_term";
+    case trace_event_kind::result:
+      return "result";
+  }
+  return "unknown";
+}
+
+inline std::ostream& operator<<(std::ostream& out, const trace_event& a_event)
+{
+  out << a_event.overload << " #" << a_event.call << " " << to_string(a_event.kind);
+  switch(a_event.kind) {
+    case trace_event_kind::deviation:
+      out << "[" << a_event.i << "]";
+      break;
+    case trace_event_kind::correlation_term:
+      out << "[" << a_event.i << "," << a_event.j << "]";
+      break;
+    default:
+      break;
+  }
+  out << " " << a_event.value;
+  if(a_event.kind == trace_event_kind::result) {
+    out << " +/- " << a_event.uncertainty;
+  }
+  return out;
+}
+
+/**
+ * A fixed size buffer that keeps the last Capacity trace events.
+ *
+ * Recording an event is a copy into a preallocated array, so the tracer can be left on in
+ * production. Old events are overwritten when the buffer is full.
+ */
+template<size_t Capacity>
+class ring_buffer_tracer
+{
+  static_assert(Capacity > 0, "ring_buffer_tracer needs room for at least one event.");
+
+ public:
+  void record(const trace_event& a_event)
+  {
+    m_events[m_recorded % Capacity] = a_event;
+    ++m_recorded;
+  }
+
+  /**
+   * Return a new id for a propagation call, used to group the events of one call.
+   */
+  size_t next_call() { return ++m_calls; }
+
+  /**
+   * The number of events in the buffer.
+   */
+  size_t size() const { return std::min(m_recorded, Capacity); }
+  static constexpr size_t capacity() { return Capacity; }
+  /**
+   * The number of events that have been overwritten.
+   */
+  size_t dropped() const { return m_recorded - size(); }
+
+  /**
+   * Call a function with each event in the buffer, oldest first.
+   */
+  template<typename Func>
+  void for_each(Func a_func) const
+  {
+    for(size_t k = m_recorded - size(); k < m_recorded; ++k) {
+      a_func(m_events[k % Capacity]);
+    }
+  }
+
+  /**
+   * Return a copy of the events in the buffer, oldest first.
+   */
+  std::vector<trace_event> events() const
+  {
+    std::vector<trace_event> ret;
+    ret.reserve(size());
+    for_each([&ret](const trace_event& e) { ret.push_back(e); });
+    return ret;
+  }
+
+  /**
+   * Return the events recorded for the most recent propagation call.
+   */
+  std::vector<trace_event> last_call() const
+  {
+    std::vector<trace_event> ret;
+    if(size() == 0) {
+      return ret;
+    }
+    size_t call = m_events[(m_recorded - 1) % Capacity].call;
+    for_each([&ret, call](const trace_event& e) {
+      if(e.call == call) {
+        ret.push_back(e);
+      }
+    });
+    return ret;
+  }
+
+  void clear() { m_recorded = 0; }
+
+ private:
+  std::array<trace_event, Capacity> m_events{};
+  size_t                            m_recorded = 0;
+  size_t                            m_calls    = 0;
+};
+
+/**
+ * An instrumentation policy that records the nominal value, deviations, correlation terms, and
+ * result of each error propagation call in a ring buffer.
+ *
+ * Each thread records to its own tracer, so recording does not need any synchronization.
+ * Use basic_error_propagator (no_instrumentation) to remove the hooks completely.
+ */
+template<size_t Capacity = 1024>
+struct tracing_instrumentation {
+  using tracer_type = ring_buffer_tracer<Capacity>;
+
+  /**
+   * Return the tracer for the calling thread.
+   */
+  static tracer_type& tracer()
+  {
+    thread_local tracer_type t;
+    return t;
+  }
+
+  class recorder : public no_instrumentation::recorder
+  {
+   public:
+    template<typename F>
+    recorder(const char* a_overload, const F& a_f) : no_instrumentation::recorder(a_overload, a_f), m_overload(a_overload), m_call(tracer().next_call())
+    {
+    }
+
+    template<typename T>
+    void on_nominal(const T& a_nominal)
+    {
+      record(trace_event_kind::nominal, 0, 0, strip_unit(a_nominal));
+    }
+    template<typename T>
+    void on_deviation(size_t a_i, const T& a_deviation)
+    {
+      record(trace_event_kind::deviation, a_i, 0, strip_unit(a_deviation));
+    }
+    template<typename T>
+    void on_correlation_term(size_t a_i, size_t a_j, const T& a_term)
+    {
+      record(trace_event_kind::correlation_term, a_i, a_j, strip_unit(a_term));
+    }
+    template<typename N, typename U>
+    void on_result(const N& a_nominal, const U& a_uncertainty)
+    {
+      record(trace_event_kind::result, 0, 0, strip_unit(a_nominal), strip_unit(a_uncertainty));
+    }
+
+   private:
+    void record(trace_event_kind a_kind, size_t a_i, size_t a_j, double a_value, double a_uncertainty = 0)
+    {
+      tracer().record({a_kind, m_overload, m_call, a_i, a_j, a_value, a_uncertainty});
+    }
+
+    const char* m_overload;
+    size_t      m_call;
+  };
+};
+
+}  // namespace libUncertainty
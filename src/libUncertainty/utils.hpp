@@ -1,8 +1,12 @@
 #pragma once
 
-#include <sstream>
-#include <iostream>
+#include <charconv>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <type_traits>
+#include <utility>
 
 /** @file utils.hpp
   * @brief Utility functions/classes
@@ -16,21 +20,42 @@ namespace libUncertainty
    * Round a number to the given number of significant figures.
    */
 template<typename T>
-auto sigfig_round(T t, size_t n) -> decltype(std::cin>>t,T())
+auto sigfig_round(T t, size_t n) -> std::enable_if_t<std::is_arithmetic_v<T>, T>
 {
   /**
-   * This is a very simple (but probably slow) method.
-   * We just use the output stream operator to write
-   * the number in scientific notation with n-1 degits after
-   * the decimal point, then read it back.
+   * This is a very simple method.
+   * We just write the number in scientific notation
+   * with n-1 digits after the decimal point, then read it back.
+   * std::to_chars rounds the same way the output stream operator does, but
+   * does not require <sstream>.
    */
-  std::stringstream ss;
-  ss.precision(n-1);
-  ss << std::scientific << t;
-  ss >> t;
-  return t;
+  if constexpr(std::is_floating_point_v<T>) {
+    char buffer[64];
+    // zero significant figures is treated as one. to_chars can not write more than 41 digits.
+    // (the clamp is written out so this header does not need <algorithm>)
+    size_t digits = n == 0 ? 1 : n;
+    if(digits > 41) {
+      digits = 41;
+    }
+    int  precision = static_cast<int>(digits - 1);
+    auto result    = std::to_chars(buffer, buffer + sizeof(buffer), t, std::chars_format::scientific, precision);
+    std::from_chars(buffer, result.ptr, t);
+    return t;
+  } else {
+    // integers are written without an exponent, so they come back unchanged.
+    return t;
+  }
 }
 
+/**
+ * Round any other type that can be read from and written to a stream.
+ *
+ * This is defined in io.hpp (it needs <sstream>, which uncertain.hpp includes). It is declared here so
+ * that the same overloads are visible in every translation unit.
+ */
+template<typename T, typename = std::enable_if_t<!std::is_arithmetic_v<T>>>
+auto sigfig_round(T t, size_t n) -> decltype(std::declval<std::istream&>() >> t, std::declval<std::ostream&>() << t, T());
+
 /**
  * Round a Boost.Units quantity<...>-like object to the given number of significant figures.
  */
@@ -68,6 +93,26 @@ size_t get_uniq_id()
   return ++id;
 }
 
+/**
+ * Compute a (64 bit FNV-1a) hash of the bits of a sequence of values.
+ *
+ * Used as the key of the memoization caches, values that compare equal but have
+ * different bits (0. and -0.) have different hashes.
+ */
+inline
+uint64_t hash_values(const double* a_vals, size_t a_n)
+{
+  uint64_t hash = 14695981039346656037ull;
+  for(size_t i = 0; i < a_n; ++i) {
+    unsigned char bytes[sizeof(double)];
+    std::memcpy(bytes, a_vals + i, sizeof(double));
+    for(auto b : bytes) {
+      hash = (hash ^ b) * 1099511628211ull;
+    }
+  }
+  return hash;
+}
+
 /**
  * A mixin class for adding an ID to a variable.
  * Used to track correlations between variables.
@@ -113,6 +158,49 @@ auto zero(priority<1>) -> decltype( T::from_value(0) )
   return T::from_value(0);
 }
 
+/**
+ * A function for getting the raw value of a Boost.Units quantity<...>-like object.
+ * Plain numbers are returned as is.
+ */
+template<typename T>
+auto strip_unit(const T& a_var) -> decltype(strip_unit(a_var, priority<2>{}))
+{
+  return strip_unit(a_var, priority<2>{});
+}
+
+template<typename T>
+T strip_unit(const T& a_var, priority<0>)
+{
+  return a_var;
+}
+
+template<typename T>
+auto strip_unit(const T& a_var, priority<1>) -> std::decay_t<decltype(a_var.value())>
+{
+  return a_var.value();
+}
+
+/**
+ * A function for creating a value of type T from a raw value. This is the inverse of strip_unit(...)
+ */
+template<typename T, typename V>
+T attach_unit(const V& a_val)
+{
+  return attach_unit<T>(a_val, priority<2>{});
+}
+
+template<typename T, typename V>
+T attach_unit(const V& a_val, priority<0>)
+{
+  return static_cast<T>(a_val);
+}
+
+template<typename T, typename V>
+auto attach_unit(const V& a_val, priority<1>) -> decltype(T::from_value(a_val))
+{
+  return T::from_value(a_val);
+}
+
 
 template<typename T>
 size_t get_id(const T& a_var)
@@ -234,4 +322,10 @@ auto get_lower(const T& a_var, priority<1>) -> decltype(a_var.lower())
 }
 
 
+
+#ifdef LIBUNCERTAINTY_EXTERN_TEMPLATES
+extern template double sigfig_round<double>(double, size_t);
+extern template int    scientific_notation_exponent<double>(double);
+#endif
+
 }  // namespace libUncertainty
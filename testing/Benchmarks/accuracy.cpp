@@ -0,0 +1,293 @@
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <random>
+#include <tuple>
+#include <utility>
+
+#include <BoostUnitDefinitions/Units.hpp>
+
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/statistics.hpp>
+#include <libUncertainty/uncertain.hpp>
+#include <libUncertainty/utils.hpp>
+
+#include "./harness.hpp"
+
+/**
+ * Accuracy versus cost of error propagation methods.
+ *
+ * Each model in the corpus has an analytic (first-order) uncertainty. Every method is used
+ * to propagate the uncertainty of the model inputs, and the relative error of the result is
+ * reported along with the number of function evaluations and the time per call. For each
+ * model, a table lists the methods, and marks the ones that are Pareto optimal (no other
+ * method is both more accurate and cheaper).
+ *
+ * Methods:
+ *   forward_difference               basic_error_propagator::propagate_error (N+1 evaluations)
+ *   forward_difference[strip_units]  the same, with tags::strip_units (models with units only)
+ *   central_difference               (f(x+dx) - f(x-dx))/2 for each argument (2N+1 evaluations)
+ *   monte_carlo[S]                   standard deviation of f over S normally distributed samples
+ *
+ * usage: libUncertainty_accuracy [--output FILE] [--filter STR] [--repetitions N] [--min-time SEC]
+ */
+
+using namespace boost::units;
+using namespace libUncertainty;
+
+namespace
+{
+/**
+ * The error and cost of one method on one model.
+ */
+struct method_result {
+  std::string method;
+  double      relative_error     = 0;
+  double      evaluations_per_op = 0;
+  double      ns_per_op          = 0;
+  bool        pareto_optimal     = false;
+};
+
+struct model_result {
+  std::string                name;
+  double                     reference = 0;
+  std::vector<method_result> methods;
+};
+
+// return the nominal values of the arguments, with argument I shifted by a_sign standard deviations.
+template<size_t I, typename... Args, size_t... J>
+auto shifted_nominals(const std::tuple<Args...>& a_args, double a_sign, std::index_sequence<J...>)
+{
+  return std::make_tuple((J == I ? get_nominal(std::get<J>(a_args)) + a_sign * get_uncertainty(std::get<J>(a_args))
+                                 : get_nominal(std::get<J>(a_args)))...);
+}
+
+template<typename F, typename... Args>
+void do_not_optimize_nominal(F& a_f, const std::tuple<Args...>& a_args)
+{
+  // the nominal value is part of the result of a real propagation method, so we compute it too.
+  bench::do_not_optimize(std::apply([&](const auto&... a) { return a_f(get_nominal(a)...); }, a_args));
+}
+
+template<typename F, typename... Args, size_t... I>
+double central_difference(F& a_f, const std::tuple<Args...>& a_args, std::index_sequence<I...> a_seq)
+{
+  do_not_optimize_nominal(a_f, a_args);
+  double sum = 0;
+  (
+      [&]() {
+        double dev = (strip_unit(std::apply(a_f, shifted_nominals<I>(a_args, +1, a_seq))) - strip_unit(std::apply(a_f, shifted_nominals<I>(a_args, -1, a_seq)))) / 2;
+        sum += dev * dev;
+      }(),
+      ...);
+  return std::sqrt(sum);
+}
+
+template<typename F, typename... Args>
+double monte_carlo(F& a_f, const std::tuple<Args...>& a_args, size_t a_samples, std::mt19937& a_gen)
+{
+  std::normal_distribution<double> z(0, 1);
+  std::vector<double>              values(a_samples);
+  for(auto& v : values) {
+    v = strip_unit(std::apply([&](const auto&... a) { return a_f((get_nominal(a) + z(a_gen) * get_uncertainty(a))...); }, a_args));
+  }
+  return standard_deviation(values.begin(), values.end());
+}
+
+/**
+ * Run all methods on a model.
+ *
+ * @param a_reference the analytic (first-order) uncertainty of the model, as a plain number in the unit of the result.
+ */
+template<typename F, typename... Args>
+model_result run_model(bench::runner& a_runner, const std::string& a_name, F a_f, double a_reference, Args... a_args)
+{
+  constexpr bool has_units = !(std::is_same_v<decltype(strip_unit(get_nominal(a_args))), decltype(get_nominal(a_args))> && ...);
+
+  model_result model;
+  model.name      = a_name;
+  model.reference = a_reference;
+
+  auto f    = bench::count_evaluations(a_f);
+  auto args = std::make_tuple(a_args...);
+  auto seq  = std::index_sequence_for<Args...>{};
+
+  std::vector<std::pair<std::string, std::function<double()>>> methods;
+  methods.emplace_back("forward_difference", [&]() {
+    return strip_unit(std::apply([&](const auto&... a) { return basic_error_propagator::propagate_error(f, a...); }, args).uncertainty());
+  });
+  if constexpr(has_units) {
+    methods.emplace_back("forward_difference[strip_units]", [&]() {
+      return strip_unit(std::apply([&](const auto&... a) { return basic_error_propagator::propagate_error(tags::strip_units{}, f, a...); }, args).uncertainty());
+    });
+  }
+  methods.emplace_back("central_difference", [&]() { return central_difference(f, args, seq); });
+  std::mt19937 gen(1);
+  for(size_t samples : {100, 1000, 10000}) {
+    methods.emplace_back("monte_carlo[" + std::to_string(samples) + "]", [&, samples]() { return monte_carlo(f, args, samples, gen); });
+  }
+
+  for(auto& [method, propagate] : methods) {
+    size_t num_results = a_runner.results().size();
+    a_runner.run("accuracy", {{"model", a_name}, {"method", method}}, propagate);
+    if(a_runner.results().size() == num_results) {
+      continue;  // filtered out
+    }
+    method_result r;
+    r.method             = method;
+    r.evaluations_per_op = a_runner.results().back().evaluations_per_op;
+    r.ns_per_op          = a_runner.results().back().mean();
+    // Monte Carlo results are random, use the rms error of several runs.
+    double sum = 0;
+    size_t runs = 20;
+    for(size_t i = 0; i < runs; ++i) {
+      double rel = propagate() / a_reference - 1;
+      sum += rel * rel;
+    }
+    r.relative_error = std::sqrt(sum / runs);
+    model.methods.push_back(r);
+  }
+
+  for(auto& r : model.methods) {
+    r.pareto_optimal = std::none_of(model.methods.begin(), model.methods.end(), [&r](const auto& o) {
+      bool no_worse = o.relative_error <= r.relative_error && o.evaluations_per_op <= r.evaluations_per_op && o.ns_per_op <= r.ns_per_op;
+      bool better   = o.relative_error < r.relative_error || o.evaluations_per_op < r.evaluations_per_op || o.ns_per_op < r.ns_per_op;
+      return no_worse && better;
+    });
+  }
+  return model;
+}
+
+std::vector<model_result> run_corpus(bench::runner& a_runner)
+{
+  std::vector<model_result> models;
+  auto                      add = [&](model_result m) {
+    if(!m.methods.empty()) {
+      models.push_back(std::move(m));
+    }
+  };
+
+  {
+    uncertain<double> x(1, 0.1), y(2, 0.05), z(3, 0.3);
+    add(run_model(
+        a_runner, "linear", [](double x, double y, double z) { return 2 * x - 3 * y + 0.5 * z; },
+        std::sqrt(std::pow(2 * 0.1, 2) + std::pow(3 * 0.05, 2) + std::pow(0.5 * 0.3, 2)), x, y, z));
+  }
+  {
+    uncertain<double> x(2, 0.05);
+    add(run_model(
+        a_runner, "polynomial", [](double x) { return x * x * x - 2 * x * x + x; }, std::abs(3 * 2 * 2 - 4 * 2 + 1) * 0.05, x));
+  }
+  {
+    // the model from the sin*cos*tan benchmark in CatchTests/benchmarks.cpp
+    double            x0 = 1, y0 = 2, z0 = 3, sx = 0.01, sy = 0.02, sz = 0.03;
+    uncertain<double> x(x0, sx), y(y0, sy), z(z0, sz);
+    double            dfdx = cos(x0) * cos(y0) * tan(z0), dfdy = -sin(x0) * sin(y0) * tan(z0), dfdz = sin(x0) * cos(y0) / (cos(z0) * cos(z0));
+    add(run_model(
+        a_runner, "trig", [](double x, double y, double z) { return sin(x) * cos(y) * tan(z); },
+        std::sqrt(std::pow(dfdx * sx, 2) + std::pow(dfdy * sy, 2) + std::pow(dfdz * sz, 2)), x, y, z));
+  }
+  {
+    double            x0 = 1.5, y0 = 2, sx = 0.02, sy = 0.03;
+    uncertain<double> x(x0, sx), y(y0, sy);
+    add(run_model(
+        a_runner, "exponential", [](double x, double y) { return exp(x * y); },
+        exp(x0 * y0) * std::sqrt(std::pow(y0 * sx, 2) + std::pow(x0 * sy, 2)), x, y));
+  }
+  {
+    double            x0 = 3, y0 = 0.5, sx = 0.1, sy = 0.02;
+    uncertain<double> x(x0, sx), y(y0, sy);
+    add(run_model(
+        a_runner, "ratio", [](double x, double y) { return x / y; },
+        std::sqrt(std::pow(sx / y0, 2) + std::pow(x0 * sy / (y0 * y0), 2)), x, y));
+  }
+  {
+    // acceleration from a free-fall time, g = 2 h / t^2
+    double                    h0 = 1.2, t0 = 0.5, sh = 0.01, st = 0.005;
+    uncertain<quantity<t::m>> h(h0 * i::m, sh * i::m);
+    uncertain<quantity<t::s>> t(t0 * i::s, st * i::s);
+    add(run_model(
+        a_runner, "free_fall", [](quantity<t::m> h, quantity<t::s> t) { return 2. * h / t / t; },
+        std::sqrt(std::pow(2 * sh / (t0 * t0), 2) + std::pow(4 * h0 * st / (t0 * t0 * t0), 2)), h, t));
+  }
+  {
+    // average speed, v = d / t
+    double                    d0 = 10, t0 = 2, sd = 0.1, st = 0.05;
+    uncertain<quantity<t::m>> d(d0 * i::m, sd * i::m);
+    uncertain<quantity<t::s>> t(t0 * i::s, st * i::s);
+    add(run_model(
+        a_runner, "average_speed", [](quantity<t::m> d, quantity<t::s> t) { return d / t; },
+        std::sqrt(std::pow(sd / t0, 2) + std::pow(d0 * st / (t0 * t0), 2)), d, t));
+  }
+  return models;
+}
+
+void write_table(std::ostream& out, const std::vector<model_result>& a_models)
+{
+  for(const auto& m : a_models) {
+    out << m.name << " (reference uncertainty " << m.reference << ")\n";
+    out << "  " << std::left << std::setw(34) << "method" << std::right << std::setw(14) << "rel. error" << std::setw(12) << "evals/op" << std::setw(14) << "ns/op"
+        << "  pareto\n";
+    for(const auto& r : m.methods) {
+      out << "  " << std::left << std::setw(34) << r.method << std::right << std::setw(14) << r.relative_error << std::setw(12) << r.evaluations_per_op << std::setw(14)
+          << r.ns_per_op << "  " << (r.pareto_optimal ? "*" : "") << "\n";
+    }
+    out << "\n";
+  }
+}
+
+void write_json(std::ostream& out, const std::vector<model_result>& a_models)
+{
+  out << "{\n  \"models\": [";
+  for(size_t i = 0; i < a_models.size(); ++i) {
+    const auto& m = a_models[i];
+    out << (i ? "," : "") << "\n    {\"name\": \"" << bench::json_escape(m.name) << "\", \"reference\": " << m.reference << ", \"methods\": [";
+    for(size_t j = 0; j < m.methods.size(); ++j) {
+      const auto& r = m.methods[j];
+      out << (j ? "," : "") << "\n      {\"method\": \"" << bench::json_escape(r.method) << "\", \"relative_error\": " << r.relative_error
+          << ", \"evaluations_per_op\": " << r.evaluations_per_op << ", \"ns_per_op\": " << r.ns_per_op
+          << ", \"pareto_optimal\": " << (r.pareto_optimal ? "true" : "false") << "}";
+    }
+    out << "\n    ]}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  bench::options opts;
+  std::string    output;
+  for(int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if(i + 1 >= argc) {
+      std::cerr << "Missing value for argument " << arg << std::endl;
+      return 1;
+    }
+    if(arg == "--output") {
+      output = argv[++i];
+    } else if(arg == "--filter") {
+      opts.filter = argv[++i];
+    } else if(arg == "--repetitions") {
+      opts.repetitions = std::stoul(argv[++i]);
+    } else if(arg == "--min-time") {
+      opts.min_time = std::stod(argv[++i]);
+    } else {
+      std::cerr << "Unknown argument " << arg << std::endl;
+      return 1;
+    }
+  }
+
+  bench::runner runner(opts);
+  auto          models = run_corpus(runner);
+
+  write_table(std::cout, models);
+  if(!output.empty()) {
+    std::ofstream out(output);
+    write_json(out, models);
+  }
+
+  return 0;
+}
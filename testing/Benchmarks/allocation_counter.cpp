@@ -0,0 +1,43 @@
+#include <cstdlib>
+#include <new>
+
+#include "./harness.hpp"
+
+/**
+ * Replacement global allocation functions that count the number of heap allocations and bytes allocated.
+ */
+
+void* operator new(std::size_t a_size)
+{
+  ++bench::allocations;
+  bench::allocated_bytes += a_size;
+  if(void* p = std::malloc(a_size ? a_size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t a_size)
+{
+  return ::operator new(a_size);
+}
+
+void operator delete(void* a_ptr) noexcept
+{
+  std::free(a_ptr);
+}
+
+void operator delete[](void* a_ptr) noexcept
+{
+  std::free(a_ptr);
+}
+
+void operator delete(void* a_ptr, std::size_t) noexcept
+{
+  std::free(a_ptr);
+}
+
+void operator delete[](void* a_ptr, std::size_t) noexcept
+{
+  std::free(a_ptr);
+}
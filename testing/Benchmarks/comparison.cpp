@@ -0,0 +1,345 @@
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <utility>
+
+#include <libUncertainty/correlation.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+// clang-format off
+#include <uncertainties/ureal.hpp>
+#include <uncertainties/impl.hpp>
+#include <uncertainties/math.hpp>
+#if defined(COMPARE_UREAL2)
+#include <uncertainties/ureal2.hpp>
+#include <uncertainties/distr.hpp>
+#endif
+// clang-format on
+
+#include "./harness.hpp"
+
+/**
+ * Comparison of libUncertainty with uncertainties-cpp (vendored in testing/include/uncertainties).
+ *
+ * uncertainties-cpp overloads the arithmetic operators and math functions, each operation
+ * propagates the error and keeps a map of the derivatives with respect to the independent
+ * variables. libUncertainty wraps a whole function instead. The cases compare the two
+ * approaches on
+ *
+ *   chain              a long chain of operations on one variable
+ *   sum                a sum of many variables
+ *   correlated_reuse   (x + y) * (x - y), where the intermediate results are correlated
+ *   second_order       x * x, where the first-order approximation is poor (uncertainties' UReal2
+ *                      propagates second-order moments, it needs Eigen and is only compared if
+ *                      COMPARE_UREAL2 is defined)
+ *
+ * and the memory used by a value derived from N independent inputs. A summary table is written
+ * to stdout, and the raw benchmark results are written as JSON with --output.
+ *
+ * usage: libUncertainty_comparison [--output FILE] [--filter STR] [--repetitions N] [--min-time SEC]
+ */
+
+using namespace libUncertainty;
+namespace unc = uncertainties;
+
+namespace
+{
+/**
+ * One implementation of a comparison case.
+ */
+struct entry {
+  std::string case_name;
+  std::string implementation;
+  double      ns_per_op          = 0;
+  double      allocations_per_op = 0;
+  double      nominal            = 0;
+  double      uncertainty        = 0;
+};
+
+template<typename T>
+std::pair<double, double> summarize(const T& a_val)
+{
+  if constexpr(is_uncertain<T>(priority<2>{})) {
+    return {a_val.nominal(), a_val.uncertainty()};
+  } else {
+    return {a_val.n(), a_val.s()};
+  }
+}
+
+class comparison
+{
+ public:
+  explicit comparison(bench::runner& a_runner) : m_runner(a_runner) {}
+
+  template<typename F>
+  void run(const std::string& a_case, const std::map<std::string, std::string>& a_params, const std::string& a_implementation, F a_body,
+           std::function<void()> a_setup = {}, size_t a_max_iterations = 1ul << 30)
+  {
+    auto params              = a_params;
+    params["implementation"] = a_implementation;
+    size_t num_results       = m_runner.results().size();
+    m_runner.run(a_case, params, a_body, a_setup, a_max_iterations);
+    if(m_runner.results().size() == num_results) {
+      return;  // filtered out
+    }
+    entry e;
+    e.case_name          = bench::runner::full_name(a_case, a_params);
+    e.implementation     = a_implementation;
+    e.ns_per_op          = m_runner.results().back().mean();
+    e.allocations_per_op = m_runner.results().back().allocations_per_op;
+    if(a_setup) {
+      a_setup();
+    }
+    std::tie(e.nominal, e.uncertainty) = summarize(a_body());
+    m_entries.push_back(e);
+  }
+
+  void write_table(std::ostream& out) const
+  {
+    std::string current;
+    for(const auto& e : m_entries) {
+      if(e.case_name != current) {
+        current = e.case_name;
+        out << "\n" << current << "\n";
+        out << "  " << std::left << std::setw(36) << "implementation" << std::right << std::setw(12) << "ns/op" << std::setw(12) << "allocs/op"
+            << std::setw(12) << "vs fastest" << "    result\n";
+      }
+      double fastest = std::numeric_limits<double>::infinity();
+      for(const auto& o : m_entries) {
+        if(o.case_name == e.case_name) {
+          fastest = std::min(fastest, o.ns_per_op);
+        }
+      }
+      out << "  " << std::left << std::setw(36) << e.implementation << std::right << std::setw(12) << e.ns_per_op << std::setw(12) << e.allocations_per_op
+          << std::setw(11) << e.ns_per_op / fastest << "x    " << e.nominal << " +/- " << e.uncertainty << "\n";
+    }
+  }
+
+ private:
+  bench::runner&     m_runner;
+  std::vector<entry> m_entries;
+};
+
+void chain_comparisons(comparison& a_comparison)
+{
+  for(size_t L : {1, 10, 100}) {
+    std::map<std::string, std::string> params{{"length", std::to_string(L)}};
+
+    unc::udouble x(0.5, 0.01);
+    a_comparison.run("chain", params, "uncertainties::udouble", [&]() {
+      unc::udouble y = x;
+      for(size_t i = 0; i < L; ++i) {
+        y = 0.5 * unc::sin(y) + 0.9 * y;
+      }
+      return y;
+    });
+
+    uncertain<double> ux(0.5, 0.01);
+    auto              step = [](double y) { return 0.5 * sin(y) + 0.9 * y; };
+    auto              f    = [L, step](double y) {
+      for(size_t i = 0; i < L; ++i) {
+        y = step(y);
+      }
+      return y;
+    };
+    a_comparison.run("chain", params, "libUncertainty (one call)", [&]() { return basic_error_propagator::propagate_error(f, ux); });
+    a_comparison.run("chain", params, "libUncertainty (call per step)", [&]() {
+      auto y = ux;
+      for(size_t i = 0; i < L; ++i) {
+        y = basic_error_propagator::propagate_error(step, y);
+      }
+      return y;
+    });
+  }
+}
+
+template<size_t... I>
+auto make_sum(std::index_sequence<I...>)
+{
+  return [](decltype(I, double())... x) { return (0. + ... + x); };
+}
+
+template<size_t N>
+void sum_comparison(comparison& a_comparison)
+{
+  std::map<std::string, std::string> params{{"variables", std::to_string(N)}};
+
+  std::vector<unc::udouble> xs;
+  for(size_t i = 0; i < N; ++i) {
+    xs.emplace_back(1 + 0.1 * i, 0.01);
+  }
+  a_comparison.run("sum", params, "uncertainties::udouble", [&]() { return std::accumulate(xs.begin() + 1, xs.end(), xs[0]); });
+
+  std::array<uncertain<double>, N> uxs;
+  for(size_t i = 0; i < N; ++i) {
+    uxs[i] = uncertain<double>(1 + 0.1 * i, 0.01);
+  }
+  auto f = make_sum(std::make_index_sequence<N>{});
+  a_comparison.run("sum", params, "libUncertainty", [&]() {
+    return std::apply([&](const auto&... x) { return basic_error_propagator::propagate_error(f, x...); }, uxs);
+  });
+}
+
+void correlated_reuse_comparisons(comparison& a_comparison)
+{
+  std::map<std::string, std::string> params;
+
+  unc::udouble x(3, 0.1), y(2, 0.2);
+  a_comparison.run("correlated_reuse", params, "uncertainties::udouble", [&]() {
+    auto a = x + y;
+    auto b = x - y;
+    return a * b;
+  });
+
+  uncertain<double> ux(3, 0.1), uy(2, 0.2);
+  a_comparison.run("correlated_reuse", params, "libUncertainty (one call)", [&]() {
+    return basic_error_propagator::propagate_error([](double x, double y) { return (x + y) * (x - y); }, ux, uy);
+  });
+
+  // the intermediate results are correlated, so calling propagate_error for each
+  // operation requires a correlation store.
+  correlation_store<double> store;
+  add_id<uncertain<double>> ix(3, 0.1), iy(2, 0.2);
+  a_comparison.run(
+      "correlated_reuse", params, "libUncertainty (store, call per step)", [&]() {
+        auto a = basic_error_propagator::propagate_error([](double x, double y) { return x + y; }, store, ix, iy);
+        auto b = basic_error_propagator::propagate_error([](double x, double y) { return x - y; }, store, ix, iy);
+        // a and b are correlated through x and y
+        store.set(a, b, store.get(a, ix) * store.get(b, ix) + store.get(a, iy) * store.get(b, iy));
+        return basic_error_propagator::propagate_error([](double a, double b) { return a * b; }, store, a, b);
+      },
+      [&]() { store.clear(); }, 100000);
+
+  a_comparison.run("correlated_reuse", params, "libUncertainty (ignoring correlation)", [&]() {
+    auto a = basic_error_propagator::propagate_error([](double x, double y) { return x + y; }, ux, uy);
+    auto b = basic_error_propagator::propagate_error([](double x, double y) { return x - y; }, ux, uy);
+    return basic_error_propagator::propagate_error([](double a, double b) { return a * b; }, a, b);
+  });
+}
+
+void second_order_comparisons(comparison& a_comparison)
+{
+  // for x ~ N(mu, sigma), x^2 has mean mu^2 + sigma^2 and standard deviation sqrt(4 mu^2 sigma^2 + 2 sigma^4).
+  double mu = 1, sigma = 0.5;
+  std::cout << "second_order reference: " << mu * mu + sigma * sigma << " +/- " << std::sqrt(4 * mu * mu * sigma * sigma + 2 * std::pow(sigma, 4)) << "\n";
+
+  std::map<std::string, std::string> params;
+
+  unc::udouble x(mu, sigma);
+  a_comparison.run("second_order", params, "uncertainties::udouble", [&]() { return x * x; });
+
+#if defined(COMPARE_UREAL2)
+  auto x2 = unc::distr::normal<unc::udouble2e>(mu, sigma);
+  a_comparison.run("second_order", params, "uncertainties::udouble2e", [&]() { return x2 * x2; });
+#endif
+
+  uncertain<double> ux(mu, sigma);
+  a_comparison.run("second_order", params, "libUncertainty", [&]() { return basic_error_propagator::propagate_error([](double x) { return x * x; }, ux); });
+}
+
+// the heap memory owned by a value, measured as the bytes allocated when copying it.
+template<typename T>
+std::pair<size_t, size_t> heap_usage(const T& a_val)
+{
+  size_t allocations = bench::allocations, bytes = bench::allocated_bytes;
+  T      copy(a_val);
+  bench::do_not_optimize(copy);
+  return {bench::allocations - allocations, bench::allocated_bytes - bytes};
+}
+
+template<size_t N>
+void memory_comparison(std::ostream& out)
+{
+  auto row = [&](const std::string& a_name, size_t a_sizeof, std::pair<size_t, size_t> a_heap) {
+    out << "  " << std::left << std::setw(56) << a_name << std::right << std::setw(4) << N << std::setw(8) << a_sizeof << std::setw(12) << a_heap.first << std::setw(12)
+        << a_heap.second << "\n";
+  };
+  auto f = make_sum(std::make_index_sequence<N>{});
+
+  std::array<uncertain<double>, N> uxs;
+  uxs.fill(uncertain<double>(1, 0.1));
+  auto u = std::apply([&](const auto&... x) { return basic_error_propagator::propagate_error(f, x...); }, uxs);
+  row("uncertain<double>", sizeof(u), heap_usage(u));
+
+  auto uc = std::apply([&](const auto&... x) { return basic_error_propagator::propagate_error_and_correlation(f, x...); }, uxs);
+  row("add_correlation_coefficient_array<uncertain<double>>", sizeof(uc), heap_usage(uc));
+
+  // the correlations of a value with an id are stored in the store, count the entries added for it.
+  correlation_store<double>                store;
+  std::array<add_id<uncertain<double>>, N> ixs;
+  std::generate(ixs.begin(), ixs.end(), []() { return add_id<uncertain<double>>(1, 0.1); });
+  auto before = heap_usage(store);
+  auto ui     = std::apply([&](const auto&... x) { return basic_error_propagator::propagate_error(f, store, x...); }, ixs);
+  auto after  = heap_usage(store);
+  row("add_id<uncertain<double>> (+ store entries)", sizeof(ui), {after.first - before.first, after.second - before.second});
+
+  std::vector<unc::udouble> xs(N, unc::udouble(1, 0.1));
+  for(auto& x : xs) {
+    x = unc::udouble(1, 0.1);  // independent variables
+  }
+  auto v = std::accumulate(xs.begin() + 1, xs.end(), xs[0]);
+  row("uncertainties::udouble", sizeof(v), heap_usage(v));
+
+#if defined(COMPARE_UREAL2)
+  std::vector<unc::udouble2e> x2s;
+  for(size_t i = 0; i < N; ++i) {
+    x2s.push_back(unc::distr::normal<unc::udouble2e>(1, 0.1));
+  }
+  auto v2 = std::accumulate(x2s.begin() + 1, x2s.end(), x2s[0]);
+  row("uncertainties::udouble2e", sizeof(v2), heap_usage(v2));
+#endif
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  bench::options opts;
+  std::string    output;
+  for(int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if(i + 1 >= argc) {
+      std::cerr << "Missing value for argument " << arg << std::endl;
+      return 1;
+    }
+    if(arg == "--output") {
+      output = argv[++i];
+    } else if(arg == "--filter") {
+      opts.filter = argv[++i];
+    } else if(arg == "--repetitions") {
+      opts.repetitions = std::stoul(argv[++i]);
+    } else if(arg == "--min-time") {
+      opts.min_time = std::stod(argv[++i]);
+    } else {
+      std::cerr << "Unknown argument " << arg << std::endl;
+      return 1;
+    }
+  }
+
+  bench::runner runner(opts);
+  comparison    comp(runner);
+  chain_comparisons(comp);
+  sum_comparison<2>(comp);
+  sum_comparison<5>(comp);
+  sum_comparison<10>(comp);
+  sum_comparison<20>(comp);
+  correlated_reuse_comparisons(comp);
+  second_order_comparisons(comp);
+  comp.write_table(std::cout);
+
+  std::cout << "\nmemory used by a value computed from N independent inputs\n";
+  std::cout << "  " << std::left << std::setw(56) << "type" << std::right << std::setw(4) << "N" << std::setw(8) << "sizeof" << std::setw(12) << "heap allocs"
+            << std::setw(12) << "heap bytes" << "\n";
+  memory_comparison<1>(std::cout);
+  memory_comparison<5>(std::cout);
+  memory_comparison<20>(std::cout);
+
+  if(!output.empty()) {
+    std::ofstream out(output);
+    runner.write_json(out, {{"library", "libUncertainty vs uncertainties-cpp"}, {"compiler", __VERSION__}});
+  }
+
+  return 0;
+}
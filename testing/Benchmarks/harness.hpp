@@ -0,0 +1,271 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "./perf_counters.hpp"
+
+/** @file harness.hpp
+ * @brief A small benchmark harness that writes its results as JSON.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace bench
+{
+/**
+ * Keep the compiler from optimizing away a value.
+ */
+template<typename T>
+inline void do_not_optimize(const T& a_val)
+{
+  asm volatile("" : : "r,m"(a_val) : "memory");
+}
+
+/**
+ * Counters updated by the benchmarked code.
+ *
+ * `allocations` and `allocated_bytes` are incremented by the replacement operator new in allocation_counter.cpp,
+ * `evaluations` is incremented by functions wrapped with count_evaluations(...).
+ */
+inline size_t allocations     = 0;
+inline size_t allocated_bytes = 0;
+inline size_t evaluations     = 0;
+
+/**
+ * Wrap a function so that each call increments the `evaluations` counter.
+ */
+template<typename F>
+auto count_evaluations(F a_f)
+{
+  return [a_f](auto&&... args) -> decltype(a_f(std::forward<decltype(args)>(args)...)) {
+    ++evaluations;
+    return a_f(std::forward<decltype(args)>(args)...);
+  };
+}
+
+/**
+ * The measurements for a single benchmark.
+ */
+struct result {
+  std::string                        name;
+  std::map<std::string, std::string> params;
+  size_t                             iterations         = 0;
+  double                             allocations_per_op = 0;
+  double                             evaluations_per_op = 0;
+  std::vector<double>                ns_per_op;  // one sample per repetition
+  std::map<std::string, double>      counters_per_op;  // hardware counters, if they were enabled and available
+
+  /**
+   * Instructions per cycle, or zero if the counters were not available.
+   */
+  double ipc() const
+  {
+    auto cycles = counters_per_op.find("cycles"), instructions = counters_per_op.find("instructions");
+    if(cycles == counters_per_op.end() || instructions == counters_per_op.end() || cycles->second == 0) {
+      return 0;
+    }
+    return instructions->second / cycles->second;
+  }
+
+  double mean() const { return std::accumulate(ns_per_op.begin(), ns_per_op.end(), 0.) / ns_per_op.size(); }
+  double median() const
+  {
+    auto v = ns_per_op;
+    std::sort(v.begin(), v.end());
+    return v.size() % 2 ? v[v.size() / 2] : (v[v.size() / 2 - 1] + v[v.size() / 2]) / 2;
+  }
+  double stddev() const
+  {
+    if(ns_per_op.size() < 2) {
+      return 0;
+    }
+    double mu  = mean();
+    double sum = std::accumulate(ns_per_op.begin(), ns_per_op.end(), 0., [mu](double s, double x) { return s + (x - mu) * (x - mu); });
+    return std::sqrt(sum / (ns_per_op.size() - 1));
+  }
+};
+
+/**
+ * Runner options.
+ */
+struct options {
+  double      min_time    = 0.05;  // seconds per repetition
+  size_t      repetitions = 5;
+  std::string filter;              // only run benchmarks whose name contains this string
+  bool        perf_counters = false;  // read hardware performance counters (Linux only)
+};
+
+inline std::string json_escape(const std::string& a_str)
+{
+  std::string out;
+  for(char c : a_str) {
+    if(c == '"' || c == '\\') {
+      out += '\\';
+    }
+    out += c;
+  }
+  return out;
+}
+
+/**
+ * Runs benchmarks and collects their results.
+ */
+class runner
+{
+ public:
+  explicit runner(options a_opts = {}) : m_opts(std::move(a_opts))
+  {
+    if(m_opts.perf_counters) {
+      m_perf_counters = std::make_unique<perf_counters>();
+      if(!m_perf_counters->any_available()) {
+        std::cerr << "Hardware performance counters are not available (check /proc/sys/kernel/perf_event_paranoid), only reporting times." << std::endl;
+        m_perf_counters.reset();
+      }
+    }
+  }
+
+  /**
+   * Run a benchmark.
+   *
+   * @param a_name the benchmark name.
+   * @param a_params parameters of this benchmark (arity, mode, size, ...) stored with the result.
+   * @param a_body the code to time. It is called many times in a loop.
+   * @param a_setup called (untimed) before each batch of calls to a_body.
+   * @param a_max_iterations the maximum number of calls to a_body in one batch.
+   */
+  template<typename F>
+  void run(const std::string& a_name, std::map<std::string, std::string> a_params, F a_body, std::function<void()> a_setup = {}, size_t a_max_iterations = 1ul << 30)
+  {
+    if(!m_opts.filter.empty() && full_name(a_name, a_params).find(m_opts.filter) == std::string::npos) {
+      return;
+    }
+    size_t                     allocations_count = 0, evaluations_count = 0;
+    perf_counters::counts_type counts{};
+    auto                       batch = [&](size_t a_n) {
+      if(a_setup) {
+        a_setup();
+      }
+      size_t allocations_start = allocations, evaluations_start = evaluations;
+      if(m_perf_counters) {
+        m_perf_counters->start();
+      }
+      auto start = std::chrono::steady_clock::now();
+      for(size_t i = 0; i < a_n; ++i) {
+        do_not_optimize(a_body());
+      }
+      auto stop = std::chrono::steady_clock::now();
+      if(m_perf_counters) {
+        auto c = m_perf_counters->stop();
+        for(size_t i = 0; i < c.size(); ++i) {
+          counts[i] += c[i];
+        }
+      }
+      allocations_count += allocations - allocations_start;
+      evaluations_count += evaluations - evaluations_start;
+      return std::chrono::duration<double, std::nano>(stop - start).count();
+    };
+
+    // find the number of iterations needed to run for at least min_time
+    size_t n = 1;
+    double t = batch(n);
+    while(t < m_opts.min_time * 1e9 && n < a_max_iterations) {
+      double scale = t > 0 ? std::min(10., 1.2 * m_opts.min_time * 1e9 / t) : 10.;
+      n            = std::min(a_max_iterations, std::max(n + 1, static_cast<size_t>(n * scale)));
+      t            = batch(n);
+    }
+
+    result r;
+    r.name       = a_name;
+    r.params     = std::move(a_params);
+    r.iterations      = n;
+    allocations_count = evaluations_count = 0;
+    counts.fill(0);
+    for(size_t i = 0; i < m_opts.repetitions; ++i) {
+      r.ns_per_op.push_back(batch(n) / n);
+    }
+    r.allocations_per_op = static_cast<double>(allocations_count) / (n * m_opts.repetitions);
+    r.evaluations_per_op = static_cast<double>(evaluations_count) / (n * m_opts.repetitions);
+    if(m_perf_counters) {
+      for(size_t i = 0; i < counts.size(); ++i) {
+        if(m_perf_counters->available(i)) {
+          r.counters_per_op[perf_counters::names()[i]] = counts[i] / (n * m_opts.repetitions);
+        }
+      }
+    }
+    std::cerr << full_name(r.name, r.params) << ": " << r.mean() << " ns/op";
+    if(r.ipc() > 0) {
+      std::cerr << ", " << r.ipc() << " IPC";
+    }
+    std::cerr << std::endl;
+    m_results.push_back(std::move(r));
+  }
+
+  const std::vector<result>& results() const { return m_results; }
+
+  void write_json(std::ostream& out, const std::map<std::string, std::string>& a_context = {}) const
+  {
+    out << "{\n  \"context\": {";
+    bool first = true;
+    for(const auto& [k, v] : a_context) {
+      out << (first ? "" : ",") << "\n    \"" << json_escape(k) << "\": \"" << json_escape(v) << "\"";
+      first = false;
+    }
+    out << "\n  },\n  \"benchmarks\": [";
+    first = true;
+    for(const auto& r : m_results) {
+      out << (first ? "" : ",") << "\n    {\"name\": \"" << json_escape(r.name) << "\", \"params\": {";
+      bool first_param = true;
+      for(const auto& [k, v] : r.params) {
+        out << (first_param ? "" : ", ") << "\"" << json_escape(k) << "\": \"" << json_escape(v) << "\"";
+        first_param = false;
+      }
+      out << "}, \"iterations\": " << r.iterations << ", \"repetitions\": " << r.ns_per_op.size();
+      out << ", \"allocations_per_op\": " << r.allocations_per_op << ", \"evaluations_per_op\": " << r.evaluations_per_op;
+      out << ", \"ns_per_op\": " << r.mean() << ", \"ns_per_op_median\": " << r.median() << ", \"ns_per_op_stddev\": " << r.stddev();
+      out << ", \"ns_per_op_samples\": [";
+      for(size_t i = 0; i < r.ns_per_op.size(); ++i) {
+        out << (i ? ", " : "") << r.ns_per_op[i];
+      }
+      out << "]";
+      if(!r.counters_per_op.empty()) {
+        out << ", \"counters_per_op\": {";
+        bool first_counter = true;
+        for(const auto& [k, v] : r.counters_per_op) {
+          out << (first_counter ? "" : ", ") << "\"" << json_escape(k) << "\": " << v;
+          first_counter = false;
+        }
+        out << "}, \"ipc\": " << r.ipc();
+      }
+      out << "}";
+      first = false;
+    }
+    out << "\n  ]\n}\n";
+  }
+
+  static std::string full_name(const std::string& a_name, const std::map<std::string, std::string>& a_params)
+  {
+    std::string name = a_name;
+    for(const auto& [k, v] : a_params) {
+      name += "/" + k + "=" + v;
+    }
+    return name;
+  }
+
+ private:
+  options                        m_opts;
+  std::vector<result>            m_results;
+  std::unique_ptr<perf_counters> m_perf_counters;
+};
+
+}  // namespace bench
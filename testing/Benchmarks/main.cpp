@@ -0,0 +1,237 @@
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+#include <BoostUnitDefinitions/Units.hpp>
+
+#include <libUncertainty/correlation.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/statistics.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+#include "./harness.hpp"
+
+/**
+ * Standalone benchmarks for libUncertainty.
+ *
+ * Results are written as JSON so they can be stored and compared between versions
+ * with scripts/compare_benchmarks.py.
+ *
+ * usage: libUncertainty_benchmarks [--output FILE] [--filter STR] [--repetitions N] [--min-time SEC] [--max-samples N] [--perf-counters]
+ */
+
+using namespace boost::units;
+using namespace libUncertainty;
+
+namespace
+{
+constexpr size_t max_arity = 20;  // the number of arguments supported by basic_error_propagator
+
+// a model with N double arguments
+template<size_t... I>
+auto make_model(std::index_sequence<I...>)
+{
+  return [](decltype(I, double())... x) { return (0. + ... + x); };
+}
+
+// a model with N length arguments
+template<size_t... I>
+auto make_quantity_model(std::index_sequence<I...>)
+{
+  return [](decltype(I, quantity<t::m>())... x) { return (0. * i::m + ... + x); };
+}
+
+template<size_t N>
+void arity_benchmarks(bench::runner& a_runner)
+{
+  std::map<std::string, std::string> params{{"arity", std::to_string(N)}};
+
+  {
+    auto                             f = bench::count_evaluations(make_model(std::make_index_sequence<N>{}));
+    std::array<uncertain<double>, N> args;
+    for(size_t i = 0; i < N; ++i) {
+      args[i] = uncertain<double>(1 + 0.1 * i, 0.01);
+    }
+
+    params["mode"] = "plain";
+    a_runner.run("propagate_error", params, [&]() {
+      return std::apply([&](const auto&... a) { return basic_error_propagator::propagate_error(f, a...); }, args);
+    });
+
+    correlation_matrix<double> corr(N);
+    for(size_t i = 0; i < N; ++i) {
+      for(size_t j = i + 1; j < N; ++j) {
+        corr(i, j) = 0.1;
+      }
+    }
+    params["mode"] = "matrix";
+    a_runner.run("propagate_error", params, [&]() {
+      return std::apply([&](const auto&... a) { return basic_error_propagator::propagate_error(f, corr, a...); }, args);
+    });
+
+    // each call adds N entries to the store, so we clear it between batches and limit the batch size.
+    correlation_store<double>                store;
+    std::array<add_id<uncertain<double>>, N> id_args;
+    for(size_t i = 0; i < N; ++i) {
+      id_args[i] = args[i];
+    }
+    auto setup = [&]() {
+      store.clear();
+      for(size_t i = 0; i < N; ++i) {
+        for(size_t j = i + 1; j < N; ++j) {
+          store.set(id_args[i], id_args[j], 0.1);
+        }
+      }
+    };
+    params["mode"] = "store";
+    a_runner.run(
+        "propagate_error", params, [&]() {
+          return std::apply([&](const auto&... a) { return basic_error_propagator::propagate_error(f, store, a...); }, id_args);
+        },
+        setup, 100000);
+  }
+
+  {
+    auto                                     f = bench::count_evaluations(make_quantity_model(std::make_index_sequence<N>{}));
+    std::array<uncertain<quantity<t::m>>, N> args;
+    for(size_t i = 0; i < N; ++i) {
+      args[i] = uncertain<quantity<t::m>>((1 + 0.1 * i) * i::m, 0.01 * i::m);
+    }
+
+    params["mode"] = "quantity";
+    a_runner.run("propagate_error", params, [&]() {
+      return std::apply([&](const auto&... a) { return basic_error_propagator::propagate_error(f, a...); }, args);
+    });
+    params["mode"] = "quantity_strip_units";
+    a_runner.run("propagate_error", params, [&]() {
+      return std::apply([&](const auto&... a) { return basic_error_propagator::propagate_error(tags::strip_units{}, f, a...); }, args);
+    });
+  }
+}
+
+template<size_t... I>
+void arity_benchmarks(bench::runner& a_runner, std::index_sequence<I...>)
+{
+  (arity_benchmarks<I + 1>(a_runner), ...);
+}
+
+void statistics_benchmarks(bench::runner& a_runner, size_t a_max_samples)
+{
+  std::mt19937                     gen(1);
+  std::normal_distribution<double> dist(10, 1);
+  for(size_t N = 1000; N <= a_max_samples; N *= 10) {
+    std::vector<double> data(N);
+    std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    std::map<std::string, std::string> params{{"samples", std::to_string(N)}};
+
+    a_runner.run("average", params, [&]() { return average(data.begin(), data.end()); });
+    a_runner.run("variance", params, [&]() { return variance(data.begin(), data.end()); });
+    a_runner.run("standard_error_of_the_mean", params, [&]() { return standard_error_of_the_mean(data.begin(), data.end()); });
+    a_runner.run("make_uncertain", params, [&]() { return make_uncertain(data.begin(), data.end()); });
+  }
+}
+
+void correlation_store_benchmarks(bench::runner& a_runner)
+{
+  std::mt19937 gen(1);
+  for(size_t N = 100; N <= 1000000; N *= 10) {
+    // N entries between ids 1...M
+    correlation_store<double> store;
+    size_t                    M = 2 * static_cast<size_t>(std::sqrt(N)) + 2;
+    std::uniform_int_distribution<size_t> id(1, M);
+    while(store.size() < N) {
+      store.set_with_ids(id(gen), id(gen), 0.5);
+    }
+    std::vector<std::pair<size_t, size_t>> keys(1024);
+    std::generate(keys.begin(), keys.end(), [&]() { return std::make_pair(id(gen), id(gen)); });
+
+    std::map<std::string, std::string> params{{"entries", std::to_string(N)}};
+    size_t                             k = 0;
+    a_runner.run("correlation_store::get_with_ids", params, [&]() {
+      auto& key = keys[k++ % keys.size()];
+      return store.get_with_ids(key.first, key.second);
+    });
+    a_runner.run("correlation_store::set_with_ids", params, [&]() {
+      auto& key = keys[k++ % keys.size()];
+      store.set_with_ids(key.first, key.second, 0.25);
+      return k;
+    });
+  }
+}
+
+// the same model with doubles, with quantities, and with quantities and tags::strip_units.
+// the stripped path should cost the same as the double path.
+void strip_units_benchmarks(bench::runner& a_runner)
+{
+  auto              f = bench::count_evaluations([](double h, double t) { return 2 * h / t / t; });
+  auto              g = bench::count_evaluations([](quantity<t::m> h, quantity<t::s> t) { return 2 * h / t / t; });
+  uncertain<double> h(1.5, 0.01), t(0.562, 0.019);
+  auto              hq = make_uncertain(1.5 * i::m, 1 * i::cm);
+  auto              tq = make_uncertain(0.562 * i::s, 19 * i::ms);
+
+  auto a = basic_error_propagator::propagate_error(f, h, t);
+  auto b = basic_error_propagator::propagate_error(tags::strip_units{}, g, hq, tq);
+  if(std::abs(b.nominal().value() - a.nominal()) > 1e-12 * std::abs(a.nominal()) ||
+     std::abs(b.uncertainty().value() - a.uncertainty()) > 1e-12 * a.uncertainty()) {
+    throw std::runtime_error("propagate_error with tags::strip_units does not match the double result.");
+  }
+
+  a_runner.run("propagate_error[free_fall]", {{"mode", "double"}}, [&]() { return basic_error_propagator::propagate_error(f, h, t); });
+  a_runner.run("propagate_error[free_fall]", {{"mode", "quantity"}}, [&]() { return basic_error_propagator::propagate_error(g, hq, tq); });
+  a_runner.run("propagate_error[free_fall]", {{"mode", "quantity_strip_units"}},
+               [&]() { return basic_error_propagator::propagate_error(tags::strip_units{}, g, hq, tq); });
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  bench::options opts;
+  std::string    output;
+  size_t         max_samples = 10000000;
+  for(int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if(arg == "--perf-counters") {
+      opts.perf_counters = true;
+      continue;
+    }
+    if(i + 1 >= argc) {
+      std::cerr << "Missing value for argument " << arg << std::endl;
+      return 1;
+    }
+    if(arg == "--output") {
+      output = argv[++i];
+    } else if(arg == "--filter") {
+      opts.filter = argv[++i];
+    } else if(arg == "--repetitions") {
+      opts.repetitions = std::stoul(argv[++i]);
+    } else if(arg == "--min-time") {
+      opts.min_time = std::stod(argv[++i]);
+    } else if(arg == "--max-samples") {
+      max_samples = std::stoul(argv[++i]);
+    } else {
+      std::cerr << "Unknown argument " << arg << std::endl;
+      return 1;
+    }
+  }
+
+  bench::runner runner(opts);
+  arity_benchmarks(runner, std::make_index_sequence<max_arity>{});
+  statistics_benchmarks(runner, max_samples);
+  correlation_store_benchmarks(runner);
+  strip_units_benchmarks(runner);
+
+  std::map<std::string, std::string> context{{"library", "libUncertainty"}, {"compiler", __VERSION__}};
+  if(output.empty()) {
+    runner.write_json(std::cout, context);
+  } else {
+    std::ofstream out(output);
+    runner.write_json(out, context);
+  }
+
+  return 0;
+}
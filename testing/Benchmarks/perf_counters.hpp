@@ -0,0 +1,125 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/** @file perf_counters.hpp
+ * @brief Hardware performance counters (Linux perf_event_open) for the benchmark harness.
+ * @author C.D. Clark III
+ * @date 10/18/26
+ */
+
+namespace bench
+{
+/**
+ * Reads the cycles, instructions, cache misses, and branch misses of the calling thread.
+ *
+ * Each counter is opened separately so that the ones that are available can be used
+ * even if others are not (virtual machines often do not expose all of them). If
+ * perf_event_open is not permitted (see /proc/sys/kernel/perf_event_paranoid) or the
+ * platform is not Linux, no counters are available and start()/stop() do nothing.
+ */
+class perf_counters
+{
+ public:
+  static constexpr size_t size = 4;
+
+  using counts_type = std::array<double, size>;
+
+  static const std::array<std::string, size>& names()
+  {
+    static const std::array<std::string, size> n{"cycles", "instructions", "cache_misses", "branch_misses"};
+    return n;
+  }
+
+  perf_counters()
+  {
+    m_fds.fill(-1);
+#if defined(__linux__)
+    const std::array<uint64_t, size> configs{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    for(size_t i = 0; i < size; ++i) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.type           = PERF_TYPE_HARDWARE;
+      attr.size           = sizeof(attr);
+      attr.config         = configs[i];
+      attr.disabled       = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      m_fds[i]            = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+  }
+  ~perf_counters()
+  {
+#if defined(__linux__)
+    for(int fd : m_fds) {
+      if(fd >= 0) {
+        close(fd);
+      }
+    }
+#endif
+  }
+  perf_counters(const perf_counters&) = delete;
+  perf_counters& operator=(const perf_counters&) = delete;
+
+  bool available(size_t a_i) const { return m_fds[a_i] >= 0; }
+  bool any_available() const
+  {
+    for(size_t i = 0; i < size; ++i) {
+      if(available(i)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void start()
+  {
+#if defined(__linux__)
+    for(int fd : m_fds) {
+      if(fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+  }
+
+  /**
+   * Stop counting and return the counts since start(). Counts are scaled up if the kernel
+   * had to multiplex the counters. Unavailable counters are zero.
+   */
+  counts_type stop()
+  {
+    counts_type counts{};
+#if defined(__linux__)
+    for(size_t i = 0; i < size; ++i) {
+      if(m_fds[i] < 0) {
+        continue;
+      }
+      ioctl(m_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+      uint64_t buf[3] = {0, 0, 0};  // value, time enabled, time running
+      if(read(m_fds[i], buf, sizeof(buf)) == sizeof(buf) && buf[2] > 0) {
+        counts[i] = static_cast<double>(buf[0]) * static_cast<double>(buf[1]) / static_cast<double>(buf[2]);
+      }
+    }
+#endif
+    return counts;
+  }
+
+ private:
+  std::array<int, size> m_fds;
+};
+
+}  // namespace bench
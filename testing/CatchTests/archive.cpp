@@ -0,0 +1,137 @@
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/archive.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace libUncertainty;
+using namespace Catch;
+
+TEST_CASE("Uncertain column archives")
+{
+  SECTION("Round trip")
+  {
+    std::vector<uncertain<double>> data{{1.23456, 0.98765}, {9.81, 0.0123}, {-3.5, 0.25}, {100.1, 0}, {100.1, 12.3}, {0, 1e-12}};
+
+    SECTION("lossless nominal")
+    {
+      auto buffer = encode_uncertain_column(data.begin(), data.end());
+      auto result = decode_uncertain_column(buffer);
+
+      REQUIRE(result.size() == data.size());
+      for(size_t i = 0; i < data.size(); ++i) {
+        CHECK(result[i].nominal() == data[i].nominal());
+        CHECK(result[i].uncertainty() == Approx(sigfig_round(data[i].uncertainty(), 2)).scale(0));
+      }
+      CHECK(result[0].uncertainty() == Approx(0.99));
+      CHECK(result[1].uncertainty() == Approx(0.012));
+      CHECK(result[3].uncertainty() == 0);
+    }
+
+    SECTION("quantized nominal")
+    {
+      auto buffer = encode_uncertain_column(data.begin(), data.end(), {1, true});
+      auto result = decode_uncertain_column(buffer);
+
+      REQUIRE(result.size() == data.size());
+      for(size_t i = 0; i < data.size(); ++i) {
+        auto normalized = data[i].normalize(1);
+        CHECK(result[i].uncertainty() == Approx(normalized.uncertainty()).scale(0));
+        if(data[i].uncertainty() > 0) {
+          CHECK(result[i].nominal() == Approx(normalized.nominal()).scale(0));
+        } else {
+          CHECK(result[i].nominal() == data[i].nominal());
+        }
+      }
+      CHECK(result[0].nominal() == Approx(1));
+      CHECK(result[1].nominal() == Approx(9.81));
+      CHECK(result[1].uncertainty() == Approx(0.01));
+      CHECK(result[4].nominal() == Approx(100));
+      CHECK(result[4].uncertainty() == Approx(10));
+    }
+
+    SECTION("special values")
+    {
+      std::vector<uncertain<double>> special{{std::numeric_limits<double>::infinity(), 1},
+                                             {2, std::numeric_limits<double>::infinity()},
+                                             {std::nan(""), std::nan("")}};
+      for(bool quantize : {false, true}) {
+        auto result = decode_uncertain_column(encode_uncertain_column(special.begin(), special.end(), {2, quantize}));
+        REQUIRE(result.size() == 3);
+        CHECK(std::isinf(result[0].nominal()));
+        CHECK(result[0].uncertainty() == Approx(1));
+        CHECK(result[1].nominal() == Approx(2));
+        CHECK(std::isinf(result[1].uncertainty()));
+        CHECK(std::isnan(result[2].nominal()));
+        CHECK(std::isnan(result[2].uncertainty()));
+      }
+    }
+
+    SECTION("empty column")
+    {
+      std::vector<uncertain<double>> empty;
+      CHECK(decode_uncertain_column(encode_uncertain_column(empty.begin(), empty.end())).size() == 0);
+    }
+  }
+
+  SECTION("Compression")
+  {
+    std::mt19937                     gen(1);
+    std::normal_distribution<double> noise(0, 0.01);
+    std::vector<uncertain<double>>   data;
+    for(int i = 0; i < 10000; ++i) {
+      data.emplace_back(9.81 + noise(gen), 0.01 + std::abs(noise(gen)) / 10);
+    }
+    size_t raw_size = data.size() * sizeof(uncertain<double>);
+
+    auto lossless  = encode_uncertain_column(data.begin(), data.end());
+    auto quantized = encode_uncertain_column(data.begin(), data.end(), {2, true});
+
+    CHECK(lossless.size() < raw_size);
+    CHECK(quantized.size() * 5 < raw_size);
+
+    auto result = decode_uncertain_column(quantized);
+    REQUIRE(result.size() == data.size());
+    CHECK(result[10].nominal() == Approx(data[10].normalize(2).nominal()).scale(0));
+  }
+
+  SECTION("Errors")
+  {
+    std::vector<uncertain<double>> data{{1, 0.1}};
+    CHECK_THROWS(encode_uncertain_column(data.begin(), data.end(), {0}));
+    CHECK_THROWS(encode_uncertain_column(data.begin(), data.end(), {16}));
+
+    auto buffer = encode_uncertain_column(data.begin(), data.end());
+    buffer[0]   = 'X';
+    CHECK_THROWS(decode_uncertain_column(buffer));
+
+    buffer = encode_uncertain_column(data.begin(), data.end());
+    buffer.resize(buffer.size() - 1);
+    CHECK_THROWS(decode_uncertain_column(buffer));
+
+    SECTION("corrupt header")
+    {
+      buffer = encode_uncertain_column(data.begin(), data.end());
+
+      auto bad_sigfigs = buffer;
+      bad_sigfigs[5]   = 0;
+      CHECK_THROWS_AS(decode_uncertain_column(bad_sigfigs), std::runtime_error);
+      bad_sigfigs[5] = 16;
+      CHECK_THROWS_AS(decode_uncertain_column(bad_sigfigs), std::runtime_error);
+      bad_sigfigs[5] = 255;
+      CHECK_THROWS_AS(decode_uncertain_column(bad_sigfigs), std::runtime_error);
+
+      // a length that does not fit in the payload must be rejected before anything is allocated
+      auto bad_length = buffer;
+      for(int i = 0; i < 8; ++i) {
+        bad_length[7 + i] = 0xff;
+      }
+      CHECK_THROWS_AS(decode_uncertain_column(bad_length), std::runtime_error);
+      bad_length = buffer;
+      bad_length[7] += 1;
+      CHECK_THROWS_AS(decode_uncertain_column(bad_length), std::runtime_error);
+    }
+  }
+}
@@ -0,0 +1,106 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+#include <BoostUnitDefinitions/Units.hpp>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/async.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace boost::units;
+using namespace libUncertainty;
+using namespace Catch;
+
+namespace
+{
+// runs each task immediately on the calling thread
+struct inline_executor {
+  size_t tasks = 0;
+  void   execute(std::function<void()> a_task)
+  {
+    ++tasks;
+    a_task();
+  }
+};
+}  // namespace
+
+TEST_CASE("Asynchronous error propagation")
+{
+  uncertain<double> x(2, 0.1);
+  uncertain<double> y(3, 0.2);
+  uncertain<double> z(4, 0.3);
+  auto              f = [](double x, double y, double z) { return x * y / z; };
+
+  SECTION("Same result as propagate_error")
+  {
+    auto a = basic_error_propagator::propagate_error(f, x, y, z);
+    auto b = async_propagate_error(f, x, y, z).get();
+    CHECK(b.nominal() == Approx(a.nominal()));
+    CHECK(b.uncertainty() == Approx(a.uncertainty()));
+
+    thread_pool pool(2);
+    auto        c = async_propagate_error(pool, f, x, y, z).get();
+    CHECK(c.uncertainty() == Approx(a.uncertainty()));
+  }
+
+  SECTION("User supplied executor")
+  {
+    inline_executor executor;
+    auto            a = async_propagate_error(executor, f, x, 3., z);
+    CHECK(executor.tasks == 3);
+    auto b = a.get();
+    CHECK(b.nominal() == Approx(1.5));
+    CHECK(b.uncertainty() == Approx(basic_error_propagator::propagate_error(f, x, 3., z).uncertainty()));
+  }
+
+  SECTION("Evaluations run concurrently")
+  {
+    // each evaluation waits (for at most 5 s) until all 6 have started, so with a pool of 6 threads
+    // they are all in flight at once. a pool that ran them one at a time would only ever have one.
+    std::atomic<int> started{0}, in_flight{0}, max_in_flight{0};
+    auto             slow = [&](double a, double b, double c, double d, double e) {
+      int now = ++in_flight;
+      int max = max_in_flight;
+      while(now > max && !max_in_flight.compare_exchange_weak(max, now)) {
+      }
+      ++started;
+      auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+      while(started < 6 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      --in_flight;
+      return a + b + c + d + e;
+    };
+    thread_pool pool(6);
+    auto        r = async_propagate_error(pool, slow, x, y, z, x, y).get();
+    CHECK(r.nominal() == Approx(14));
+    CHECK(max_in_flight == 6);
+  }
+
+  SECTION("Exceptions are passed to the future")
+  {
+    auto throws = [](double a, double b) -> double {
+      if(a > 2) {
+        throw std::runtime_error("out of range");
+      }
+      return a + b;
+    };
+    auto r = async_propagate_error(throws, x, y);
+    CHECK_THROWS_AS(r.get(), std::runtime_error);
+  }
+
+  SECTION("Units")
+  {
+    uncertain<quantity<t::m>> l(2 * i::m, 0.1 * i::m);
+    uncertain<quantity<t::s>> t(4 * i::s, 0.2 * i::s);
+    auto                      speed = [](quantity<t::m> l, quantity<t::s> t) { return l / t; };
+    auto                      a     = basic_error_propagator::propagate_error(speed, l, t);
+    auto                      b     = async_propagate_error(speed, l, t).get();
+    CHECK(b.nominal().value() == Approx(a.nominal().value()));
+    CHECK(b.uncertainty().value() == Approx(a.uncertainty().value()));
+  }
+}
@@ -0,0 +1,113 @@
+#include <BoostUnitDefinitions/Units.hpp>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/correlation.hpp>
+#include <libUncertainty/instrumentation.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace boost::units;
+using namespace libUncertainty;
+using namespace Catch;
+
+namespace
+{
+struct area {
+  auto operator()(double w, double h) const { return w * h; }
+};
+}  // namespace
+
+TEST_CASE("Uncertainty budget")
+{
+  uncertain<double> w(2, 0.1);
+  uncertain<double> h(3, 0.3);
+
+  SECTION("Uncorrelated inputs")
+  {
+    auto budget = basic_error_propagator::propagate_error_budget(area{}, w, h);
+    auto z      = basic_error_propagator::propagate_error(area{}, w, h);
+
+    CHECK(budget.size() == 2);
+    CHECK(budget.result.nominal() == Approx(z.nominal()));
+    CHECK(budget.result.uncertainty() == Approx(z.uncertainty()));
+
+    CHECK(budget.contributions[0] == Approx(0.3));
+    CHECK(budget.contributions[1] == Approx(0.6));
+    CHECK(budget.sensitivities[0] == Approx(3));
+    CHECK(budget.sensitivities[1] == Approx(2));
+    CHECK(budget.correlation_terms[0][1] == 0);
+
+    CHECK(budget.variance_fraction(0) == Approx(0.09 / 0.45));
+    CHECK(budget.variance_fraction(1) == Approx(0.36 / 0.45));
+    CHECK(budget.dominant_input() == 1);
+  }
+
+  SECTION("Inputs that are not uncertain")
+  {
+    auto budget = basic_error_propagator::propagate_error_budget(area{}, w, 3.);
+    CHECK(budget.contributions[1] == 0);
+    CHECK(budget.sensitivities[1] == 0);
+    CHECK(budget.variance_fraction(0) == Approx(1));
+  }
+
+  SECTION("Correlated inputs")
+  {
+    correlation_matrix<double> corr(2);
+    corr(0, 1) = 0.5;
+    auto budget = basic_error_propagator::propagate_error_budget(area{}, corr, w, h);
+    auto z      = basic_error_propagator::propagate_error(area{}, corr, w, h);
+
+    CHECK(budget.result.uncertainty() == Approx(z.uncertainty()));
+    CHECK(budget.correlation_terms[0][1] == Approx(0.5 * 0.3 * 0.6));
+    CHECK(budget.correlation_terms[1][0] == Approx(0.5 * 0.3 * 0.6));
+    CHECK(budget.variance_fraction(0) + budget.variance_fraction(1) == Approx(1));
+    CHECK(budget.variance_fraction(0) == Approx((0.09 + 0.09) / (0.45 + 0.18)));
+  }
+
+  SECTION("Correlation store")
+  {
+    add_id<uncertain<double>> wi(2, 0.1);
+    add_id<uncertain<double>> hi(3, 0.3);
+    correlation_store<double> store;
+    store.set(wi, hi, 0.5);
+    auto budget = basic_error_propagator::propagate_error_budget(area{}, store, wi, hi);
+    auto z      = basic_error_propagator::propagate_error(area{}, store, wi, hi);
+
+    CHECK(budget.result.uncertainty() == Approx(z.uncertainty()));
+    CHECK(budget.correlation_terms[0][1] == Approx(0.5 * 0.3 * 0.6));
+    CHECK(budget.variance_fraction(0) == Approx((0.09 + 0.09) / (0.45 + 0.18)));
+    // only the call to propagate_error(...) added its result to the store
+    CHECK(store.size() == 3);
+  }
+
+  SECTION("Result without uncertainty")
+  {
+    auto budget = basic_error_propagator::propagate_error_budget(area{}, uncertain<double>(2, 0), 3.);
+    CHECK(budget.result.uncertainty() == 0);
+    CHECK(budget.variance_fraction(0) == 0);
+    CHECK(budget.variance_fraction(1) == 0);
+    CHECK(budget.dominant_input() == 0);
+  }
+
+  SECTION("No extra function evaluations")
+  {
+    using propagator = instrumented_error_propagator<counting_instrumentation>;
+    counting_instrumentation::registry().clear();
+    propagator::propagate_error_budget(area{}, w, h);
+    CHECK(counting_instrumentation::registry().get("propagate_error_budget", area{}).function_evaluations == 3);
+    CHECK(counting_instrumentation::registry().get("propagate_error_budget", area{}).allocations == 0);
+  }
+
+  SECTION("Units")
+  {
+    uncertain<quantity<t::m>> x(2 * i::m, 0.1 * i::m);
+    uncertain<quantity<t::s>> t(4 * i::s, 0.2 * i::s);
+    auto budget = basic_error_propagator::propagate_error_budget([](quantity<t::m> x, quantity<t::s> t) { return x / t; }, x, t);
+
+    CHECK(budget.result.nominal().value() == Approx(0.5));
+    CHECK(budget.contributions[0].value() == Approx(0.025));
+    CHECK(budget.contributions[1].value() == Approx(2 / 4.2 - 0.5));
+    CHECK(budget.sensitivities[0] == Approx(0.25));
+    CHECK(budget.variance_fraction(0) + budget.variance_fraction(1) == Approx(1));
+  }
+}
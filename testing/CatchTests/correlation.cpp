@@ -20,8 +20,8 @@ TEST_CASE("Correlations Utilities")
     CHECK(mat(1, 0) == Approx(0).scale(1));
     CHECK(mat(0, 2) == Approx(0).scale(1));
     CHECK(mat(2, 0) == Approx(0).scale(1));
-    CHECK(mat(0, 3) == Approx(0).scale(1));
-    CHECK(mat(3, 0) == Approx(0).scale(1));
+    CHECK(mat(1, 2) == Approx(0).scale(1));
+    CHECK(mat(2, 1) == Approx(0).scale(1));
     CHECK(mat(0, 0) == Approx(1));
     CHECK(mat(1, 1) == Approx(1));
     CHECK(mat(2, 2) == Approx(1));
@@ -34,11 +34,28 @@ TEST_CASE("Correlations Utilities")
     CHECK(mat(1, 0) == Approx(0.1));
     CHECK(mat(0, 2) == Approx(0.2));
     CHECK(mat(2, 0) == Approx(0.2));
-    CHECK(mat(0, 3) == Approx(0.3));
-    CHECK(mat(3, 0) == Approx(0.3));
+    CHECK(mat(1, 2) == Approx(0.3));
+    CHECK(mat(2, 1) == Approx(0.3));
     CHECK(mat(0, 0) == Approx(1));
     CHECK(mat(1, 1) == Approx(1));
     CHECK(mat(2, 2) == Approx(1));
+    CHECK(mat.size() == 3);
+
+    // every element of a larger matrix has its own storage
+    correlation_matrix<double> big(5);
+    CHECK(big.size() == 5);
+    for(int i = 0; i < 5; ++i) {
+      for(int j = i + 1; j < 5; ++j) {
+        big(i, j) = 0.1 * i + 0.01 * j;
+      }
+    }
+    for(int i = 0; i < 5; ++i) {
+      CHECK(big(i, i) == Approx(1));
+      for(int j = i + 1; j < 5; ++j) {
+        CHECK(big(i, j) == Approx(0.1 * i + 0.01 * j));
+        CHECK(big(j, i) == Approx(0.1 * i + 0.01 * j));
+      }
+    }
   }
 
   SECTION("Error propagation w/ correlation matrix.")
@@ -95,6 +112,13 @@ TEST_CASE("Correlations Utilities")
 
     CHECK(store.get(x, y) == Approx(0.1));
     CHECK(store.get(y, z) == Approx(0.2));
+    CHECK(store.size() == 2);
+
+    store.clear();
+    CHECK(store.size() == 0);
+    CHECK(store.get(x, y) == Approx(0).scale(1));
+    store.add(x, y, 0.1);
+    CHECK(store.get(x, y) == Approx(0.1));
 
     auto& global_store = get_global_correlation_store();
 
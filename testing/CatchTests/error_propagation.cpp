@@ -84,6 +84,62 @@ TEST_CASE("Error Propagation Tests")
       }
     }
   }
+  SECTION("Stripping units")
+  {
+    SECTION("Length quantity")
+    {
+      uncertain<quantity<t::cm>> L(2 * i::cm, 0.1 * i::cm);
+      uncertain<quantity<t::cm>> W(4 * i::cm, 0.2 * i::cm);
+
+      auto A = basic_error_propagator::propagate_error(tags::strip_units{}, [](quantity<t::cm> L, quantity<t::cm> W) { return L * W; }, L, W);
+
+      CHECK(A.nominal().value() == Approx(8));
+      CHECK(A.uncertainty().value() == Approx(0.5656854));
+      CHECK(quantity<t::mm_p2>(A.uncertainty()).value() == Approx(56.56854));
+    }
+    SECTION("Different units")
+    {
+      auto h = make_uncertain(1.5 * i::m, 1 * i::cm);
+      auto t = make_uncertain(0.562 * i::s, 19 * i::ms);
+
+      auto f = [](quantity<t::m> h, quantity<t::s> t) { return 2 * h / t / t; };
+
+      auto g = basic_error_propagator::propagate_error(f, h, t);
+      auto s = basic_error_propagator::propagate_error(tags::strip_units{}, f, h, t);
+
+      CHECK(s.nominal().value() == Approx(g.nominal().value()));
+      CHECK(s.uncertainty().value() == Approx(g.uncertainty().value()));
+    }
+    SECTION("Mixed with exact values")
+    {
+      auto t = make_uncertain(0.562 * i::s, 19 * i::ms);
+
+      auto g = basic_error_propagator::propagate_error(tags::strip_units{}, [](quantity<t::m> h, quantity<t::s> t) { return 2 * h / t / t; }, 1.5 * i::m, t);
+
+      CHECK(g.nominal().value() == Approx(2 * 1.5 / 0.562 / 0.562));
+      CHECK(g.uncertainty().value() == Approx(2 * 1.5 / 0.562 / 0.562 - 2 * 1.5 / 0.581 / 0.581));
+    }
+    SECTION("Same result as doubles")
+    {
+      auto              f = [](double h, double t) { return 2 * h / t / t; };
+      auto              g = [](quantity<t::m> h, quantity<t::s> t) { return 2 * h / t / t; };
+      uncertain<double> h(1.5, 0.01), t(0.562, 0.019);
+
+      auto a = basic_error_propagator::propagate_error(f, h, t);
+      auto b = basic_error_propagator::propagate_error(tags::strip_units{}, g, make_uncertain(1.5 * i::m, 1 * i::cm), make_uncertain(0.562 * i::s, 19 * i::ms));
+
+      CHECK(b.nominal().value() == Approx(a.nominal()));
+      CHECK(b.uncertainty().value() == Approx(a.uncertainty()));
+    }
+    SECTION("doubles")
+    {
+      auto y = basic_error_propagator::propagate_error(tags::strip_units{}, [](double x, double y) { return x * y; }, uncertain<double>(2, 0.2), 3.);
+
+      CHECK(y.nominal() == Approx(6));
+      CHECK(y.uncertainty() == Approx(0.6));
+    }
+  }
+
   SECTION("Mixing uncertain with exact quantities")
   {
     SECTION("doubles")
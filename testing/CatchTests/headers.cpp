@@ -0,0 +1,69 @@
+// The core headers must be included first, so that we can check which standard headers they pull in.
+#include <libUncertainty/propagate_core.hpp>
+#include <libUncertainty/uncertain_core.hpp>
+
+// libstdc++ include guards
+#if defined(_GLIBCXX_IOSTREAM) || defined(_GLIBCXX_SSTREAM) || defined(_GLIBCXX_ISTREAM) || defined(_GLIBCXX_OSTREAM)
+constexpr bool core_includes_iostreams = true;
+#else
+constexpr bool core_includes_iostreams = false;
+#endif
+#if defined(_GLIBCXX_MAP)
+constexpr bool core_includes_map = true;
+#else
+constexpr bool core_includes_map = false;
+#endif
+
+#include <sstream>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/correlation.hpp>
+#include <libUncertainty/io.hpp>
+
+using namespace libUncertainty;
+using namespace Catch;
+
+TEST_CASE("Header layout")
+{
+  SECTION("Core headers do not include iostreams or map")
+  {
+#if defined(__GLIBCXX__)
+    CHECK(!core_includes_iostreams);
+    CHECK(!core_includes_map);
+#endif
+  }
+
+  SECTION("Propagating error with the core headers")
+  {
+    uncertain<double> x(1, 0.1);
+    uncertain<double> y(2, 0.2);
+
+    auto z = basic_error_propagator::propagate_error([](double x, double y) { return x + y; }, x, y);
+    CHECK(z.nominal() == Approx(3));
+    CHECK(z.uncertainty() == Approx(sqrt(0.1 * 0.1 + 0.2 * 0.2)));
+  }
+
+  SECTION("Correlation and io headers add to the core")
+  {
+    add_id<uncertain<double>> x(1, 0.1);
+    add_id<uncertain<double>> y(2, 0.2);
+    correlation_store<double> store;
+    store.set(x, y, -1);
+
+    auto z = basic_error_propagator::propagate_error([](double x, double y) { return x + y; }, store, x, y);
+    CHECK(z.uncertainty() == Approx(0.1));
+
+    auto w = basic_error_propagator::propagate_error_and_correlation([](double x, double y) { return x * y; }, x, y);
+    CHECK(w.get_correlation_coefficients().size() == 2);
+
+    std::stringstream out;
+    out << z;
+    CHECK(out.str() == "3 +/- 0.1");
+
+    uncertain<double> v;
+    std::stringstream in("1.5 +/- 0.25");
+    in >> v;
+    CHECK(v.nominal() == Approx(1.5));
+    CHECK(v.uncertainty() == Approx(0.25));
+  }
+}
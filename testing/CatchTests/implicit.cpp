@@ -0,0 +1,101 @@
+#include <BoostUnitDefinitions/Units.hpp>
+#include <cmath>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/implicit.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace boost::units;
+using namespace libUncertainty;
+using namespace Catch;
+
+namespace
+{
+// solve y^3 + a y - b = 0 by bisection
+double solve_cubic(double a, double b)
+{
+  double lo = -10, hi = 10;
+  for(int i = 0; i < 200; ++i) {
+    double mid = (lo + hi) / 2;
+    if(mid * mid * mid + a * mid - b > 0) {
+      hi = mid;
+    } else {
+      lo = mid;
+    }
+  }
+  return (lo + hi) / 2;
+}
+}  // namespace
+
+TEST_CASE("Implicit function error propagation")
+{
+  SECTION("Single input")
+  {
+    // y^2 = x
+    uncertain<double> x(4, 0.1);
+    auto              y = implicit_propagate([](double y, double x) { return y * y - x; }, [](double x) { return std::sqrt(x); }, x);
+
+    CHECK(y.nominal() == Approx(2));
+    CHECK(y.uncertainty() == Approx(0.1 / 4).epsilon(1e-4));
+    CHECK(y.get_correlation_coefficients().size() == 1);
+    CHECK(y.get_correlation_coefficient(0) == Approx(1));
+  }
+
+  SECTION("Agrees with propagating through the solver")
+  {
+    uncertain<double> a(2, 0.1), b(5, 0.2);
+    int               g_calls = 0;
+    int               solves  = 0;
+    auto              g       = [&](double y, double a, double b) {
+      ++g_calls;
+      return y * y * y + a * y - b;
+    };
+    auto solve = [&](double a, double b) {
+      ++solves;
+      return solve_cubic(a, b);
+    };
+
+    auto y = implicit_propagate(g, solve, a, b);
+    CHECK(solves == 1);
+    CHECK(g_calls == 4);
+
+    // dy/da = -y / (3y^2 + a), dy/db = 1 / (3y^2 + a)
+    double y0  = solve_cubic(2, 5);
+    double dya = -y0 / (3 * y0 * y0 + 2) * 0.1;
+    double dyb = 1 / (3 * y0 * y0 + 2) * 0.2;
+    double unc = std::sqrt(dya * dya + dyb * dyb);
+    CHECK(y.nominal() == Approx(y0));
+    CHECK(y.uncertainty() == Approx(unc).epsilon(1e-6));
+    CHECK(y.get_correlation_coefficient(0) == Approx(dya / unc).epsilon(1e-6));
+    CHECK(y.get_correlation_coefficient(1) == Approx(dyb / unc).epsilon(1e-6));
+
+    // propagating through the solver takes N+1 solves, and gives the same result to first order
+    auto z = basic_error_propagator::propagate_error_and_correlation(solve, a, b);
+    CHECK(solves == 1 + 3);
+    CHECK(y.nominal() == Approx(z.nominal()));
+    CHECK(y.uncertainty() == Approx(z.uncertainty()).epsilon(0.02));
+
+    // certain inputs do not contribute, and are not evaluated
+    g_calls = 0;
+    auto w  = implicit_propagate(g, solve, 2., b);
+    CHECK(g_calls == 3);
+    CHECK(w.get_correlation_coefficient(0) == Approx(0).scale(1));
+    CHECK(w.get_correlation_coefficient(1) == Approx(1));
+  }
+
+  SECTION("Quantities")
+  {
+    uncertain<quantity<t::m_p2>> area(4. * i::m * i::m, 0.1 * i::m * i::m);
+    auto y = implicit_propagate([](quantity<t::m> y, quantity<t::m_p2> a) { return y * y - a; },
+                                [](quantity<t::m_p2> a) { return quantity<t::m>::from_value(std::sqrt(a.value())); }, area);
+    CHECK(y.nominal().value() == Approx(2));
+    CHECK(y.uncertainty().value() == Approx(0.1 / 4).epsilon(1e-4));
+  }
+
+  SECTION("Singular equation")
+  {
+    uncertain<double> x(0, 0.1);
+    CHECK_THROWS_AS(implicit_propagate([](double, double x) { return x; }, [](double) { return 0.; }, x), std::runtime_error);
+  }
+}
@@ -0,0 +1,107 @@
+#include <BoostUnitDefinitions/Units.hpp>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/correlation.hpp>
+#include <libUncertainty/instrumentation.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace boost::units;
+using namespace libUncertainty;
+using namespace Catch;
+
+namespace
+{
+struct sum3 {
+  auto operator()(double x, double y, double z) const { return x + y + z; }
+};
+struct length_sum {
+  auto operator()(quantity<t::m> x, quantity<t::m> y) const { return x + y; }
+};
+}  // namespace
+
+TEST_CASE("Instrumentation")
+{
+  using propagator = instrumented_error_propagator<counting_instrumentation>;
+  auto& registry   = counting_instrumentation::registry();
+  registry.clear();
+
+  uncertain<double> x(1, 0.1);
+  uncertain<double> y(2, 0.2);
+  uncertain<double> z(3, 0.3);
+
+  SECTION("Counting does not change the result")
+  {
+    auto a = basic_error_propagator::propagate_error(sum3{}, x, y, z);
+    auto b = propagator::propagate_error(sum3{}, x, y, z);
+    CHECK(b.nominal() == Approx(a.nominal()));
+    CHECK(b.uncertainty() == Approx(a.uncertainty()));
+  }
+
+  SECTION("Function evaluations")
+  {
+    propagator::propagate_error(sum3{}, x, y, z);
+    propagator::propagate_error(sum3{}, x, y, z);
+    // the nominal value, plus one evaluation for each uncertain argument
+    propagator::propagate_error(sum3{}, x, 2., z);
+
+    auto stats = registry.get("propagate_error", sum3{});
+    CHECK(stats.calls == 3);
+    CHECK(stats.function_evaluations == 4 + 4 + 3);
+    CHECK(stats.allocations == 0);
+    CHECK(stats.latency.count == 3);
+    CHECK(stats.get_stage_latency(propagation_stage::evaluate).count == 3);
+    CHECK(stats.get_stage_latency(propagation_stage::combine).count == 3);
+    CHECK(stats.get_stage_latency(propagation_stage::correlate).count == 0);
+    CHECK(stats.latency.percentile(0.5) <= stats.latency.max_ns);
+
+    CHECK(registry.get("propagate_error[matrix]", sum3{}).calls == 0);
+    CHECK(registry.sites().size() == 1);
+  }
+
+  SECTION("Call sites are separated by overload and function type")
+  {
+    correlation_matrix<double> corr(3);
+    propagator::propagate_error(sum3{}, corr, x, y, z);
+    propagator::propagate_error([](double x, double y) { return x * y; }, x, y);
+
+    CHECK(registry.get("propagate_error[matrix]", sum3{}).calls == 1);
+    CHECK(registry.get("propagate_error[matrix]", sum3{}).function_evaluations == 4);
+    CHECK(registry.get("propagate_error", sum3{}).calls == 0);
+    CHECK(registry.sites().size() == 2);
+  }
+
+  SECTION("Allocations")
+  {
+    auto r = propagator::propagate_error_and_correlation(sum3{}, x, y, z);
+    CHECK(r.get_correlation_coefficients().size() == 3);
+    CHECK(registry.get("propagate_error_and_correlation", sum3{}).allocations == 1);
+    CHECK(registry.get("propagate_error_and_correlation", sum3{}).get_stage_latency(propagation_stage::correlate).count == 1);
+
+    correlation_store<double> store;
+    add_id<uncertain<double>> xx(1, 0.1), yy(2, 0.2), zz(3, 0.3);
+    store.set(xx, yy, 0.5);
+    propagator::propagate_error(sum3{}, store, xx, yy, zz);
+    auto stats = registry.get("propagate_error[store]", sum3{});
+    CHECK(stats.calls == 1);
+    CHECK(stats.function_evaluations == 4);
+    CHECK(stats.allocations == 3);
+    CHECK(store.size() == 4);
+  }
+
+  SECTION("Stripping units is recorded once")
+  {
+    uncertain<quantity<t::m>> a(1 * i::m, 0.1 * i::m);
+    uncertain<quantity<t::m>> b(2 * i::m, 0.2 * i::m);
+    auto                      r = propagator::propagate_error(tags::strip_units{}, length_sum{}, a, b);
+    CHECK(r.nominal().value() == Approx(3));
+    CHECK(r.uncertainty().value() == Approx(sqrt(0.1 * 0.1 + 0.2 * 0.2)));
+
+    auto stats = registry.get("propagate_error[strip_units]", length_sum{});
+    CHECK(stats.calls == 1);
+    CHECK(stats.function_evaluations == 3);
+    CHECK(registry.sites().size() == 1);
+  }
+
+  registry.clear();
+}
@@ -0,0 +1,215 @@
+#include <cmath>
+#include <iterator>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/correlation.hpp>
+#include <libUncertainty/linear_fit.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace libUncertainty;
+using namespace Catch;
+
+TEST_CASE("Linear least-squares fitting")
+{
+  std::vector<double>            x = {0, 1, 2, 3, 4};
+  std::vector<double>            y_values = {1.1, 2.9, 5.2, 6.8, 9.1};
+  std::vector<uncertain<double>> y;
+  for(auto v : y_values) {
+    y.emplace_back(v, 0.1);
+  }
+
+  // closed form solution for a weighted straight line fit with equal uncertainties
+  double S = 0, Sx = 0, Sy = 0, Sxx = 0, Sxy = 0;
+  for(size_t i = 0; i < x.size(); ++i) {
+    double w = 1 / (0.1 * 0.1);
+    S += w;
+    Sx += w * x[i];
+    Sy += w * y_values[i];
+    Sxx += w * x[i] * x[i];
+    Sxy += w * x[i] * y_values[i];
+  }
+  double D = S * Sxx - Sx * Sx;
+
+  SECTION("Weighted straight line")
+  {
+    auto fit = linear_fit(x.begin(), x.end(), y.begin());
+    CHECK(fit.parameters[0].nominal() == Approx((Sxx * Sy - Sx * Sxy) / D));
+    CHECK(fit.parameters[1].nominal() == Approx((S * Sxy - Sx * Sy) / D));
+    CHECK(fit.parameters[0].uncertainty() == Approx(sqrt(Sxx / D)));
+    CHECK(fit.parameters[1].uncertainty() == Approx(sqrt(S / D)));
+    CHECK(fit.covariance[0][1] == Approx(-Sx / D));
+    CHECK(fit.correlation(0, 1) == Approx(-Sx / sqrt(S * Sxx)));
+    CHECK(fit.dof == 3);
+    CHECK(fit.chi2 > 0);
+
+    // the uncertainty of the fitted line at a point
+    auto y5   = basic_error_propagator::propagate_error([](double a, double b) { return a + b * 5; }, fit.correlation, fit.parameters[0], fit.parameters[1]);
+    double var = fit.covariance[0][0] + 25 * fit.covariance[1][1] + 10 * fit.covariance[0][1];
+    CHECK(y5.uncertainty() == Approx(sqrt(var)));
+    CHECK(fit.prediction_uncertainty({1, 5}) == Approx(sqrt(var)));
+  }
+
+  SECTION("Unweighted straight line")
+  {
+    auto fit = linear_fit(x.begin(), x.end(), y_values.begin());
+    CHECK(fit.parameters[1].nominal() == Approx((S * Sxy - Sx * Sy) / D));
+    // the covariance is scaled by the residual variance
+    CHECK(fit.parameters[1].uncertainty() == Approx(sqrt(fit.reduced_chi2() / (Sxx / 100 - Sx * Sx / 100 / S))));
+  }
+
+  SECTION("Polynomial")
+  {
+    std::vector<double> yq;
+    for(auto v : x) {
+      yq.push_back(1 - 2 * v + 0.5 * v * v);
+    }
+    auto fit = linear_fit(polynomial_basis<2>{}, x.begin(), x.end(), yq.begin());
+    CHECK(fit.parameters[0].nominal() == Approx(1));
+    CHECK(fit.parameters[1].nominal() == Approx(-2));
+    CHECK(fit.parameters[2].nominal() == Approx(0.5));
+    CHECK(fit.chi2 == Approx(0).scale(1));
+  }
+
+  SECTION("Uncertain x")
+  {
+    std::vector<uncertain<double>> xu;
+    for(auto v : x) {
+      xu.emplace_back(v, 0.05);
+    }
+    auto fit  = linear_fit(xu.begin(), xu.end(), y.begin());
+    auto fit0 = linear_fit(x.begin(), x.end(), y.begin());
+    // sigma_eff^2 = 0.1^2 + (slope * 0.05)^2 with all points equal, so the slope does not change but its uncertainty does
+    double slope = fit0.parameters[1].nominal();
+    CHECK(fit.parameters[1].nominal() == Approx(slope));
+    CHECK(fit.parameters[1].uncertainty() == Approx(fit0.parameters[1].uncertainty() * sqrt(1 + pow(slope * 0.05 / 0.1, 2))));
+
+    // without uncertainties in y, the x uncertainties can not be weighed against anything
+    CHECK_THROWS_AS(linear_fit(xu.begin(), xu.end(), y_values.begin()), std::invalid_argument);
+  }
+
+  SECTION("Some points without uncertainty")
+  {
+    std::vector<uncertain<double>> mixed = y;
+    mixed[2]                              = uncertain<double>(5.2, 0);
+    CHECK_THROWS_AS(linear_fit(x.begin(), x.end(), mixed.begin()), std::invalid_argument);
+    for(auto& m : mixed) {
+      m.uncertainty(0);
+    }
+    mixed[3].uncertainty(0.1);
+    CHECK_THROWS_AS(linear_fit(x.begin(), x.end(), mixed.begin()), std::invalid_argument);
+  }
+
+  SECTION("Single-pass input iterators")
+  {
+    // with certain x, each point is read once
+    std::istringstream xs("0 1 2 3 4"), ys("1.1 2.9 5.2 6.8 9.1");
+    auto               fit = linear_fit(std::istream_iterator<double>(xs), std::istream_iterator<double>(), std::istream_iterator<double>(ys));
+    CHECK(fit.parameters[1].nominal() == Approx((S * Sxy - Sx * Sy) / D));
+  }
+
+  SECTION("Streaming and merging")
+  {
+    linear_least_squares_accumulator<2> a, b;
+    std::thread                         t([&]() {
+      for(size_t i = 0; i < 3; ++i) {
+        a.add(straight_line_basis{}(x[i]), y_values[i], 100);
+      }
+    });
+    for(size_t i = 3; i < x.size(); ++i) {
+      b.add(straight_line_basis{}(x[i]), y_values[i], 100);
+    }
+    t.join();
+    a.merge(b);
+    CHECK(a.count() == 5);
+    auto fit = a.solve();
+    CHECK(fit.parameters[1].nominal() == Approx((S * Sxy - Sx * Sy) / D));
+    CHECK(fit.parameters[1].uncertainty() == Approx(sqrt(S / D)));
+
+    linear_least_squares_accumulator<3> too_few;
+    too_few.add({1, 0, 0}, 1);
+    CHECK_THROWS_AS(too_few.solve(), std::invalid_argument);
+  }
+
+  SECTION("Data far from x = 0")
+  {
+    // many exact points of y = 2x + 1 +/- 0.01 with a large offset in x. accumulating the
+    // normal equations directly loses the intercept and chi^2 to cancellation.
+    linear_least_squares_accumulator<2> acc;
+    size_t                              n = 1000000;
+    for(size_t i = 0; i < n; ++i) {
+      double xi = 1e5 + i * 1e-3;
+      acc.add(straight_line_basis{}(xi), 2 * xi + 1, 1e4);
+    }
+    auto fit = acc.solve();
+
+    double mean = 1e5 + (n - 1) * 1e-3 / 2, Sxx = 0;
+    for(size_t i = 0; i < n; ++i) {
+      Sxx += (1e5 + i * 1e-3 - mean) * (1e5 + i * 1e-3 - mean);
+    }
+    CHECK(fit.parameters[0].nominal() == Approx(1).epsilon(1e-4));
+    CHECK(fit.parameters[1].nominal() == Approx(2).epsilon(1e-10));
+    CHECK(fit.parameters[0].uncertainty() == Approx(0.01 * sqrt(1. / n + mean * mean / Sxx)));
+    CHECK(fit.parameters[1].uncertainty() == Approx(0.01 / sqrt(Sxx)));
+    CHECK(fit.chi2 < 1e-3);
+  }
+
+  SECTION("Ill-conditioned polynomial")
+  {
+    // a cubic fit to points near x = 1000. the same fit in x - 1005 is well conditioned, and its
+    // constant term is the value (and uncertainty) of the fitted function at x = 1005.
+    linear_least_squares_accumulator<4> acc, shifted;
+    for(int i = 0; i <= 1000; ++i) {
+      double xi = 1000 + i * 0.01;
+      double yi = 1 + xi - 1e-3 * xi * xi + 1e-6 * xi * xi * xi;
+      acc.add(polynomial_basis<3>{}(xi), yi, 1e4);
+      shifted.add(polynomial_basis<3>{}(xi - 1005), yi, 1e4);
+    }
+    auto fit  = acc.solve();
+    auto fits = shifted.solve();
+    CHECK(fit.prediction_uncertainty(polynomial_basis<3>{}(1005)) == Approx(fits.parameters[0].uncertainty()).epsilon(1e-6));
+    CHECK(fits.prediction_uncertainty(polynomial_basis<3>{}(0)) == Approx(fits.parameters[0].uncertainty()));
+  }
+
+  SECTION("Perfect fit with the covariance from the residuals")
+  {
+    std::vector<double> xp = {0, 1, 2, 3}, yp = {1, 3, 5, 7};
+    auto                fit = linear_fit(xp.begin(), xp.end(), yp.begin());
+    CHECK(fit.parameters[0].nominal() == Approx(1));
+    CHECK(fit.parameters[1].nominal() == Approx(2));
+    CHECK(fit.parameters[1].uncertainty() == Approx(0).scale(1));
+    CHECK(!std::isnan(fit.correlation(0, 1)));
+    CHECK(fit.prediction_uncertainty({1, 5}) == Approx(0).scale(1));
+
+    // with as many points as parameters there are no residuals to estimate the uncertainty from
+    CHECK_THROWS_AS(linear_fit(xp.begin(), xp.begin() + 2, yp.begin()), std::invalid_argument);
+  }
+
+  SECTION("Generalized least squares")
+  {
+    // without correlations, the result is the same as a weighted fit
+    correlation_matrix<double> none(5);
+    auto                       fit  = generalized_linear_fit(straight_line_basis{}, x.begin(), x.end(), y.begin(), none);
+    auto                       fitw = linear_fit(x.begin(), x.end(), y.begin());
+    CHECK(fit.parameters[0].nominal() == Approx(fitw.parameters[0].nominal()));
+    CHECK(fit.parameters[1].nominal() == Approx(fitw.parameters[1].nominal()));
+    CHECK(fit.parameters[1].uncertainty() == Approx(fitw.parameters[1].uncertainty()));
+
+    // a correlation common to all points (an offset error) goes into the intercept, not the slope
+    correlation_matrix<double> common(5);
+    for(int i = 0; i < 5; ++i) {
+      for(int j = i + 1; j < 5; ++j) {
+        common(i, j) = 0.5;
+      }
+    }
+    auto fitc = generalized_linear_fit(straight_line_basis{}, x.begin(), x.end(), y.begin(), common);
+    CHECK(fitc.parameters[1].nominal() == Approx(fitw.parameters[1].nominal()));
+    CHECK(fitc.parameters[1].uncertainty() == Approx(fitw.parameters[1].uncertainty() * sqrt(0.5)));
+    CHECK(fitc.parameters[0].uncertainty() > fitw.parameters[0].uncertainty());
+
+    CHECK_THROWS_AS(generalized_linear_fit(straight_line_basis{}, x.begin(), x.end(), y.begin(), correlation_matrix<double>(3)), std::invalid_argument);
+  }
+}
@@ -0,0 +1,127 @@
+#include <cmath>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/matrix.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace libUncertainty;
+using namespace Catch;
+
+TEST_CASE("Uncertain matrix algebra")
+{
+  uncertain<double> a(4, 0.01), b(1, 0.02), c(2, 0.03), d(3, 0.04);
+  uncertain_matrix  A(2, 2, {a, b, c, d});
+
+  SECTION("Element access")
+  {
+    CHECK(A.rows() == 2);
+    CHECK(A.cols() == 2);
+    CHECK(A(1, 0).nominal() == Approx(2));
+    CHECK(A(1, 0).uncertainty() == Approx(0.03));
+    A.set(1, 0, uncertain<double>(5, 0.5));
+    CHECK(A.nominal(1, 0) == Approx(5));
+    CHECK(A.uncertainty(1, 0) == Approx(0.5));
+    CHECK_THROWS_AS(uncertain_matrix(2, 2, {a, b, c}), std::invalid_argument);
+  }
+
+  SECTION("Multiply")
+  {
+    uncertain_matrix B(2, 1, {uncertain<double>(1, 0.1), uncertain<double>(2, 0.2)});
+    auto             C = A * B;
+    REQUIRE(C.rows() == 2);
+    REQUIRE(C.cols() == 1);
+
+    auto c0 = basic_error_propagator::propagate_error([](double a, double b, double x, double y) { return a * x + b * y; }, a, b, B(0, 0), B(1, 0));
+    CHECK(C.nominal(0, 0) == Approx(c0.nominal()));
+    CHECK(C.uncertainty(0, 0) == Approx(c0.uncertainty()));
+
+    CHECK_THROWS_AS(B * A, std::invalid_argument);
+  }
+
+  SECTION("Solve")
+  {
+    uncertain<double> u(1, 0.1), v(2, 0.2);
+    uncertain_matrix  B(2, 1, {u, v});
+    auto              X = A.solve(B);
+
+    // Cramer's rule
+    auto x = basic_error_propagator::propagate_error([](double a, double b, double c, double d, double u, double v) { return (u * d - b * v) / (a * d - b * c); },
+                                                     a, b, c, d, u, v);
+    auto y = basic_error_propagator::propagate_error([](double a, double b, double c, double d, double u, double v) { return (a * v - u * c) / (a * d - b * c); },
+                                                     a, b, c, d, u, v);
+    CHECK(X.nominal(0, 0) == Approx(x.nominal()));
+    CHECK(X.nominal(1, 0) == Approx(y.nominal()));
+    CHECK(X.uncertainty(0, 0) == Approx(x.uncertainty()).epsilon(1e-3));
+    CHECK(X.uncertainty(1, 0) == Approx(y.uncertainty()).epsilon(1e-3));
+
+    uncertain_matrix S(2, 2, {1, 2, 2, 4});
+    CHECK_THROWS_AS(S.solve(B), std::runtime_error);
+  }
+
+  SECTION("Solve an ill-conditioned system")
+  {
+    // the solution comes from the LU factorization. multiplying by the inverse leaves a much
+    // larger residual for a Hilbert matrix.
+    size_t           n = 10;
+    uncertain_matrix H(n, n), b(n, 1);
+    for(size_t i = 0; i < n; ++i) {
+      double sum = 0;
+      for(size_t j = 0; j < n; ++j) {
+        H.set(i, j, 1. / (i + j + 1));
+        sum += 1. / (i + j + 1);
+      }
+      b.set(i, 0, sum);
+    }
+    auto X = H.solve(b);
+    auto R = H.multiply(X);
+    for(size_t i = 0; i < n; ++i) {
+      CHECK(R.nominal(i, 0) == Approx(b.nominal(i, 0)).epsilon(1e-14));
+    }
+  }
+
+  SECTION("Inverse")
+  {
+    auto Ainv = A.inverse();
+    auto i01  = basic_error_propagator::propagate_error([](double a, double b, double c, double d) { return -b / (a * d - b * c); }, a, b, c, d);
+    auto i11  = basic_error_propagator::propagate_error([](double a, double b, double c, double d) { return a / (a * d - b * c); }, a, b, c, d);
+    CHECK(Ainv.nominal(0, 1) == Approx(i01.nominal()));
+    CHECK(Ainv.nominal(1, 1) == Approx(i11.nominal()));
+    // propagate_error(...) uses a finite step, so it agrees to first order
+    CHECK(Ainv.uncertainty(0, 1) == Approx(i01.uncertainty()).epsilon(2e-2));
+    CHECK(Ainv.uncertainty(1, 1) == Approx(i11.uncertainty()).epsilon(2e-2));
+    // A^-1 = [[0.3, -0.1], [-0.2, 0.4]], var(X_11) = sum_kl (A^-1_1k)^2 sA_kl^2 (A^-1_l1)^2
+    CHECK(Ainv.uncertainty(1, 1) == Approx(sqrt(0.04 * 1e-4 * 0.01 + 0.04 * 4e-4 * 0.16 + 0.16 * 9e-4 * 0.01 + 0.16 * 16e-4 * 0.16)));
+
+    auto I = A.multiply(Ainv);
+    CHECK(I.nominal(0, 0) == Approx(1));
+    CHECK(I.nominal(0, 1) == Approx(0).scale(1));
+  }
+
+  SECTION("Large matrices and threads")
+  {
+    size_t           n = 100;
+    uncertain_matrix M(n, n), R(n, 3);
+    for(size_t i = 0; i < n; ++i) {
+      for(size_t j = 0; j < n; ++j) {
+        M.set(i, j, uncertain<double>(i == j ? n : std::sin(i + 2. * j), 0.01));
+      }
+      for(size_t j = 0; j < 3; ++j) {
+        R.set(i, j, uncertain<double>(std::cos(i * 1. + j), 0.01));
+      }
+    }
+    auto X1 = M.solve(R);
+    auto X4 = M.solve(R, 4);
+    auto P1 = M.multiply(M);
+    auto P4 = M.multiply(M, 4);
+    for(size_t i = 0; i < n; ++i) {
+      CHECK(X4.nominal(i, 2) == Approx(X1.nominal(i, 2)));
+      CHECK(X4.uncertainty(i, 2) == Approx(X1.uncertainty(i, 2)));
+      CHECK(P4.nominal(i, i / 2) == Approx(P1.nominal(i, i / 2)));
+      CHECK(P4.uncertainty(i, i / 2) == Approx(P1.uncertainty(i, i / 2)));
+    }
+    // the solution satisfies M X = R
+    auto MX = M.multiply(X4);
+    CHECK(MX.nominal(17, 1) == Approx(R.nominal(17, 1)));
+  }
+}
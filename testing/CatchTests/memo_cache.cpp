@@ -0,0 +1,154 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <BoostUnitDefinitions/Units.hpp>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/memo_cache.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace boost::units;
+using namespace libUncertainty;
+using namespace Catch;
+
+TEST_CASE("Memo cache")
+{
+  SECTION("Storing and reading entries")
+  {
+    memo_cache<> cache(10);
+    CHECK(cache.capacity() == 16);
+
+    double key[] = {1, 2};
+    CHECK(!cache.get(key, 2));
+    cache.put(key, 2, 3);
+    REQUIRE(cache.get(key, 2));
+    CHECK(*cache.get(key, 2) == 3);
+    CHECK(!cache.get(key, 1));
+    double other[] = {2, 1};
+    CHECK(!cache.get(other, 2));
+    CHECK(cache.hits() == 2);
+    CHECK(cache.misses() == 3);
+
+    cache.put(key, 2, 4);
+    CHECK(*cache.get(key, 2) == 4);
+
+    cache.clear();
+    CHECK(!cache.get(key, 2));
+
+    CHECK_THROWS_AS(memo_cache<>(0), std::invalid_argument);
+    std::vector<double> too_long(21);
+    CHECK_THROWS_AS(cache.get(too_long.data(), too_long.size()), std::invalid_argument);
+  }
+
+  SECTION("Least recently used entries are evicted")
+  {
+    // one set with two slots
+    memo_cache<1, 2> cache(1);
+    double           a = 1, b = 2, c = 3;
+    cache.put(&a, 1, 1);
+    cache.put(&b, 1, 2);
+    cache.get(&a, 1);
+    cache.put(&c, 1, 3);
+    CHECK(cache.get(&a, 1));
+    CHECK(!cache.get(&b, 1));
+    CHECK(cache.get(&c, 1));
+  }
+
+  SECTION("Only changed points are evaluated")
+  {
+    int  calls = 0;
+    auto f     = memoize([&calls](double x, double y, double z) {
+      ++calls;
+      return x * y + z;
+    });
+
+    uncertain<double> x(2, 0.1);
+    uncertain<double> y(3, 0.2);
+    uncertain<double> z(4, 0.3);
+    auto              a = basic_error_propagator::propagate_error(f, x, y, z);
+    CHECK(calls == 4);
+    auto b = basic_error_propagator::propagate_error(f, x, y, z);
+    CHECK(calls == 4);
+    CHECK(b.nominal() == a.nominal());
+    CHECK(b.uncertainty() == a.uncertainty());
+
+    // a new uncertainty for z only changes the point where z is perturbed
+    basic_error_propagator::propagate_error(f, x, y, uncertain<double>(4, 0.4));
+    CHECK(calls == 5);
+    // a new nominal value for z changes all points
+    basic_error_propagator::propagate_error(f, x, y, uncertain<double>(5, 0.3));
+    CHECK(calls == 9);
+    CHECK(f.cache->hits() == 4 + 3);
+  }
+
+  SECTION("Long double arguments are not rounded to double")
+  {
+    // x.upper() rounds to the same double as x.nominal(), so a double key would return the nominal result
+    auto                     f = memoize([](long double x) { return x * 1e19L; });
+    uncertain<long double>   x(1, 2e-19L);
+    auto                     plain = basic_error_propagator::propagate_error([](long double x) { return x * 1e19L; }, x);
+    auto                     y     = basic_error_propagator::propagate_error(f, x);
+    CHECK(double(y.uncertainty()) == Approx(double(plain.uncertainty())));
+    CHECK(double(y.uncertainty()) == Approx(2));
+    CHECK(f.cache->misses() == 2);
+
+    basic_error_propagator::propagate_error(f, x);
+    CHECK(f.cache->hits() == 2);
+  }
+
+  SECTION("Keys and values of other types")
+  {
+    memo_cache<> cache;
+    uint64_t     key[] = {1, 2};
+    cache.put(key, 2, 3.5L);
+    REQUIRE(cache.get<long double>(key, 2));
+    CHECK(*cache.get<long double>(key, 2) == 3.5L);
+    // an entry stored with a different value size does not match
+    CHECK(!cache.get<float>(key, 2));
+  }
+
+  SECTION("Units")
+  {
+    int  calls = 0;
+    auto f     = memoize([&calls](quantity<t::m> x, quantity<t::s> t) {
+      ++calls;
+      return x / t;
+    });
+
+    uncertain<quantity<t::m>> x(2 * i::m, 0.1 * i::m);
+    uncertain<quantity<t::s>> t(4 * i::s, 0.2 * i::s);
+    auto                      a = basic_error_propagator::propagate_error(f, x, t);
+    auto                      b = basic_error_propagator::propagate_error(f, x, t);
+    CHECK(calls == 3);
+    CHECK(b.nominal().value() == Approx(0.5));
+    CHECK(b.uncertainty().value() == Approx(a.uncertainty().value()));
+  }
+
+  SECTION("Concurrent readers and writers")
+  {
+    memo_cache<2>            cache(64);
+    std::atomic<int>         wrong{0};
+    std::vector<std::thread> threads;
+    for(int k = 0; k < 4; ++k) {
+      threads.emplace_back([&cache, &wrong, k]() {
+        for(int n = 0; n < 2000; ++n) {
+          double key[] = {double(n % 100), double(k)};
+          if(auto val = cache.get(key, 2)) {
+            if(*val != key[0] * 10 + key[1]) {
+              ++wrong;
+            }
+          } else {
+            cache.put(key, 2, key[0] * 10 + key[1]);
+          }
+        }
+      });
+    }
+    for(auto& t : threads) {
+      t.join();
+    }
+    CHECK(wrong == 0);
+    CHECK(cache.hits() + cache.misses() == 4 * 2000);
+  }
+}
@@ -0,0 +1,112 @@
+#include <cmath>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/linear_fit.hpp>
+#include <libUncertainty/nonlinear_fit.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace libUncertainty;
+using namespace Catch;
+
+TEST_CASE("Nonlinear least-squares fitting")
+{
+  std::vector<double>            x;
+  std::vector<uncertain<double>> y;
+  // exponential decay, with a small deterministic "noise"
+  for(int i = 0; i < 20; ++i) {
+    x.push_back(0.5 * i);
+    y.emplace_back(3 * exp(-x.back() / 2.) + 0.01 * ((i % 3) - 1), 0.01);
+  }
+  auto decay = [](double x, double A, double tau) { return A * exp(-x / tau); };
+
+  SECTION("Exponential decay")
+  {
+    auto fit = nonlinear_fit(decay, std::array<double, 2>{1, 1}, x.begin(), x.end(), y.begin());
+    CHECK(fit.converged);
+    CHECK(fit.parameters[0].nominal() == Approx(3).epsilon(0.01));
+    CHECK(fit.parameters[1].nominal() == Approx(2).epsilon(0.01));
+    CHECK(fit.parameters[0].uncertainty() > 0);
+    CHECK(fit.parameters[0].uncertainty() < 0.02);
+    CHECK(fit.dof == 18);
+    CHECK(fit.reduced_chi2() < 2);
+    CHECK(fit.correlation(0, 1) == Approx(fit.covariance[0][1] / sqrt(fit.covariance[0][0] * fit.covariance[1][1])));
+
+    // the parameters can be used to propagate error through the model
+    auto y1 = basic_error_propagator::propagate_error([](double A, double tau) { return A * exp(-1 / tau); }, fit.correlation, fit.parameters[0], fit.parameters[1]);
+    CHECK(y1.nominal() == Approx(3 * exp(-0.5)).epsilon(0.01));
+  }
+
+  SECTION("Agrees with the linear fit for a linear model")
+  {
+    std::vector<uncertain<double>> yl;
+    for(size_t i = 0; i < x.size(); ++i) {
+      yl.emplace_back(1 + 2 * x[i] + 0.05 * ((i % 3) - 1), 0.1);
+    }
+    auto fit  = nonlinear_fit([](double x, double a, double b) { return a + b * x; }, std::array<double, 2>{0, 0}, x.begin(), x.end(), yl.begin());
+    auto fitl = linear_fit(x.begin(), x.end(), yl.begin());
+    CHECK(fit.parameters[0].nominal() == Approx(fitl.parameters[0].nominal()));
+    CHECK(fit.parameters[1].nominal() == Approx(fitl.parameters[1].nominal()));
+    CHECK(fit.parameters[0].uncertainty() == Approx(fitl.parameters[0].uncertainty()).epsilon(1e-5));
+    CHECK(fit.parameters[1].uncertainty() == Approx(fitl.parameters[1].uncertainty()).epsilon(1e-5));
+    CHECK(fit.covariance[0][1] == Approx(fitl.covariance[0][1]).epsilon(1e-5));
+    CHECK(fit.chi2 == Approx(fitl.chi2).epsilon(1e-5));
+
+    // with uncertain x, too
+    std::vector<uncertain<double>> xu;
+    for(auto v : x) {
+      xu.emplace_back(v, 0.02);
+    }
+    auto fitx  = nonlinear_fit([](double x, double a, double b) { return a + b * x; }, std::array<double, 2>{0, 0}, xu.begin(), xu.end(), yl.begin());
+    auto fitxl = linear_fit(xu.begin(), xu.end(), yl.begin());
+    CHECK(fitx.parameters[1].nominal() == Approx(fitxl.parameters[1].nominal()));
+    CHECK(fitx.parameters[1].uncertainty() == Approx(fitxl.parameters[1].uncertainty()).epsilon(1e-4));
+  }
+
+  SECTION("Parallel evaluation gives the same result")
+  {
+    levenberg_marquardt_options options;
+    auto                        serial = nonlinear_fit(decay, std::array<double, 2>{1, 1}, x.begin(), x.end(), y.begin(), options);
+    options.threads                    = 4;
+    auto parallel                      = nonlinear_fit(decay, std::array<double, 2>{1, 1}, x.begin(), x.end(), y.begin(), options);
+    CHECK(parallel.parameters[0].nominal() == Approx(serial.parameters[0].nominal()));
+    CHECK(parallel.parameters[1].nominal() == Approx(serial.parameters[1].nominal()));
+    CHECK(parallel.parameters[1].uncertainty() == Approx(serial.parameters[1].uncertainty()));
+  }
+
+  SECTION("Unweighted data")
+  {
+    std::vector<double> yd;
+    for(auto& v : y) {
+      yd.push_back(v.nominal());
+    }
+    auto fit = nonlinear_fit(decay, std::array<double, 2>{1, 1}, x.begin(), x.end(), yd.begin());
+    CHECK(fit.parameters[1].nominal() == Approx(2).epsilon(0.01));
+    // the covariance is estimated from the residuals
+    CHECK(fit.reduced_chi2() < 1e-3);
+    CHECK(fit.parameters[1].uncertainty() > 0);
+
+    CHECK_THROWS_AS(nonlinear_fit(decay, std::array<double, 2>{1, 1}, x.begin(), x.begin() + 1, yd.begin()), std::invalid_argument);
+    CHECK_THROWS_AS(nonlinear_fit(decay, std::array<double, 2>{1, 1}, x.begin(), x.begin() + 2, yd.begin()), std::invalid_argument);
+
+    // uncertainties in x are not ignored without uncertainties in y
+    std::vector<uncertain<double>> xu;
+    for(auto v : x) {
+      xu.emplace_back(v, 0.02);
+    }
+    CHECK_THROWS_AS(nonlinear_fit(decay, std::array<double, 2>{1, 1}, xu.begin(), xu.end(), yd.begin()), std::invalid_argument);
+  }
+
+  SECTION("Unweighted data without noise")
+  {
+    std::vector<double> yd;
+    for(auto v : x) {
+      yd.push_back(3 * exp(-v / 2.));
+    }
+    auto fit = nonlinear_fit(decay, std::array<double, 2>{1, 1}, x.begin(), x.end(), yd.begin());
+    CHECK(fit.parameters[0].nominal() == Approx(3));
+    CHECK(fit.parameters[1].nominal() == Approx(2));
+    CHECK(!std::isnan(fit.correlation(0, 1)));
+  }
+}
@@ -0,0 +1,110 @@
+#include <cmath>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/ode.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace libUncertainty;
+using namespace Catch;
+
+TEST_CASE("ODE error propagation")
+{
+  // dx/dt = -k x
+  auto decay = [](double, const std::array<double, 1>& x, const std::array<double, 1>& p) { return std::array<double, 1>{-p[0] * x[0]}; };
+  std::array<uncertain<double>, 1> k{uncertain<double>(0.5, 0.05)};
+
+  SECTION("Exponential decay")
+  {
+    for(auto method : {ode_method::rk4, ode_method::dormand_prince}) {
+      ode_options options;
+      options.method = method;
+      auto x         = ode_propagate(decay, std::array<double, 1>{1}, k, 0, 2, options);
+
+      CHECK(x.t == Approx(2));
+      CHECK(x.state[0].nominal() == Approx(exp(-1)).epsilon(1e-7));
+      CHECK(x.sensitivities[0][0] == Approx(-2 * exp(-1)).epsilon(1e-5));
+      CHECK(x.state[0].uncertainty() == Approx(0.05 * 2 * exp(-1)).epsilon(1e-5));
+    }
+
+    // agrees with propagating error through the solution (to first order)
+    std::array<uncertain<double>, 1> k_small{uncertain<double>(0.5, 0.0001)};
+    auto x = ode_propagate(decay, std::array<double, 1>{1}, k_small, 0, 2);
+    auto y = basic_error_propagator::propagate_error([](double k) { return exp(-2 * k); }, k_small[0]);
+    CHECK(x.state[0].uncertainty() == Approx(y.uncertainty()).epsilon(1e-3));
+  }
+
+  SECTION("Model that is nonlinear in a small parameter")
+  {
+    // dy/dt = -exp(-1000 p) y with p = 1e-3, next to a large constant state. the difference
+    // step for p must follow the scale of p, not of the largest state.
+    auto steep = [](double, const std::array<double, 2>& x, const std::array<double, 1>& p) {
+      return std::array<double, 2>{0, -x[1] * std::exp(-1000 * p[0])};
+    };
+    std::array<uncertain<double>, 1> p{uncertain<double>(1e-3, 1e-6)};
+    auto                             x = ode_propagate(steep, std::array<double, 2>{1e6, 1}, p, 0, 1);
+
+    double rate = exp(-1);
+    CHECK(x.state[0].nominal() == Approx(1e6));
+    CHECK(x.state[1].nominal() == Approx(exp(-rate)).epsilon(1e-7));
+    // y = exp(-exp(-1000 p) t), so dy/dp = 1000 t exp(-1000 p) y
+    CHECK(x.sensitivities[1][0] == Approx(1000 * rate * exp(-rate)).epsilon(1e-5));
+  }
+
+  SECTION("Trajectory and output correlations")
+  {
+    // x decays into y, so x + y is conserved and x and y are anti-correlated
+    auto chain = [](double, const std::array<double, 2>& x, const std::array<double, 1>& p) {
+      return std::array<double, 2>{-p[0] * x[0], p[0] * x[0]};
+    };
+    auto trajectory = ode_propagate_trajectory(chain, std::array<double, 2>{1, 0}, k, std::vector<double>{0, 1, 2, 3});
+
+    REQUIRE(trajectory.size() == 4);
+    CHECK(trajectory[0].state[0].nominal() == Approx(1));
+    CHECK(trajectory[0].state[0].uncertainty() == Approx(0).scale(1));
+    for(size_t n = 1; n < trajectory.size(); ++n) {
+      double t = n;
+      CHECK(trajectory[n].t == Approx(t));
+      CHECK(trajectory[n].state[0].nominal() == Approx(exp(-0.5 * t)).epsilon(1e-7));
+      CHECK(trajectory[n].state[1].nominal() == Approx(1 - exp(-0.5 * t)).epsilon(1e-7));
+      CHECK(trajectory[n].state[0].uncertainty() == Approx(0.05 * t * exp(-0.5 * t)).epsilon(1e-5));
+      CHECK(trajectory[n].correlation(0, 1) == Approx(-1));
+      CHECK(trajectory[n].covariance[0][1] == Approx(-trajectory[n].covariance[0][0]).epsilon(1e-5));
+    }
+  }
+
+  SECTION("Correlated parameters")
+  {
+    // dx/dt = -(a + b) x
+    auto decay2 = [](double, const std::array<double, 1>& x, const std::array<double, 2>& p) { return std::array<double, 1>{-(p[0] + p[1]) * x[0]}; };
+    std::array<uncertain<double>, 2> ab{uncertain<double>(0.2, 0.05), uncertain<double>(0.3, 0.05)};
+
+    auto x = ode_propagate(decay2, std::array<double, 1>{1}, ab, 0, 2);
+    CHECK(x.state[0].uncertainty() == Approx(sqrt(2) * 0.05 * 2 * exp(-1)).epsilon(1e-5));
+
+    correlation_matrix<double> corr(2);
+    corr(0, 1) = -1;
+    auto xc    = ode_propagate(decay2, std::array<double, 1>{1}, ab, corr, 0, 2);
+    CHECK(xc.state[0].nominal() == Approx(exp(-1)).epsilon(1e-7));
+    CHECK(xc.state[0].uncertainty() == Approx(0).scale(1e-3));
+
+    // rounding in the sensitivities makes the sum for the variance slightly negative for these values
+    std::array<uncertain<double>, 2> cancel{uncertain<double>(0.533, 0.05), uncertain<double>(0.459, 0.05)};
+    xc = ode_propagate(decay2, std::array<double, 1>{1}, cancel, corr, 0, 2);
+    CHECK(xc.covariance[0][0] >= 0);
+    CHECK(!std::isnan(xc.state[0].uncertainty()));
+    CHECK(xc.state[0].uncertainty() == Approx(0).scale(1e-3));
+
+    corr(0, 1) = 1;
+    xc         = ode_propagate(decay2, std::array<double, 1>{1}, ab, corr, 0, 2);
+    CHECK(xc.state[0].uncertainty() == Approx(2 * 0.05 * 2 * exp(-1)).epsilon(1e-5));
+
+    CHECK_THROWS_AS(ode_propagate(decay2, std::array<double, 1>{1}, ab, correlation_matrix<double>(3), 0, 2), std::invalid_argument);
+  }
+
+  SECTION("Backward integration")
+  {
+    auto x = ode_propagate(decay, std::array<double, 1>{exp(-1)}, k, 2, 0);
+    CHECK(x.state[0].nominal() == Approx(1).epsilon(1e-7));
+  }
+}
@@ -0,0 +1,151 @@
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <BoostUnitDefinitions/Units.hpp>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/persistent_cache.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace boost::units;
+using namespace libUncertainty;
+using namespace Catch;
+
+TEST_CASE("Persistent cache")
+{
+  // a unique name, so test runs in parallel do not share the file
+  auto path = std::filesystem::temp_directory_path() / ("libUncertainty_persistent_cache_test_" + std::to_string(std::random_device{}()) + ".cache");
+  std::filesystem::remove(path);
+
+  SECTION("Storing and reading entries")
+  {
+    persistent_cache cache(path);
+    CHECK(!cache.get("model", {1, 2}));
+    cache.put("model", {1, 2}, 3);
+    CHECK(cache.size() == 1);
+    REQUIRE(cache.get("model", {1, 2}));
+    CHECK(*cache.get("model", {1, 2}) == 3);
+    CHECK(!cache.get("model", {2, 1}));
+    CHECK(!cache.get("other-model", {1, 2}));
+
+    // values are stored exactly
+    cache.put("model", {0.1}, 1. / 3);
+    CHECK(*cache.get("model", {0.1}) == 1. / 3);
+
+    // a second cache object (or process) sees the same entries
+    persistent_cache cache2(path);
+    CHECK(cache2.size() == 2);
+    CHECK(*cache2.get("model", {1, 2}) == 3);
+
+    cache.clear();
+    CHECK(cache2.size() == 0);
+
+    CHECK_THROWS_AS(cache.put("my model", {1}, 1), std::invalid_argument);
+    CHECK_THROWS_AS(persistent_cache(path, 0), std::invalid_argument);
+  }
+
+  SECTION("Least recently used entries are evicted")
+  {
+    persistent_cache cache(path, 2);
+    cache.put("model", {1}, 1);
+    cache.put("model", {2}, 2);
+    cache.get("model", {1});
+    cache.put("model", {3}, 3);
+    CHECK(cache.size() == 2);
+    CHECK(cache.get("model", {1}));
+    CHECK(!cache.get("model", {2}));
+    CHECK(cache.get("model", {3}));
+  }
+
+  SECTION("Memoizing error propagation")
+  {
+    persistent_cache cache(path);
+    int              calls = 0;
+    auto             f     = memoize_persistent(cache, "product", [&calls](double x, double y) {
+      ++calls;
+      return x * y;
+    });
+
+    uncertain<double> x(2, 0.1);
+    uncertain<double> y(3, 0.2);
+    auto              a = basic_error_propagator::propagate_error(f, x, y);
+    CHECK(calls == 3);
+    auto b = basic_error_propagator::propagate_error(f, x, y);
+    CHECK(calls == 3);
+    CHECK(b.nominal() == a.nominal());
+    CHECK(b.uncertainty() == a.uncertainty());
+    CHECK(a.nominal() == Approx(6));
+
+    basic_error_propagator::propagate_error(f, x, uncertain<double>(3, 0.3));
+    // only the point with the new upper value of y is evaluated
+    CHECK(calls == 4);
+  }
+
+  SECTION("Malformed lines")
+  {
+    {
+      persistent_cache cache(path);
+      cache.put("model", {1, 2}, 3);
+    }
+    {
+      std::ofstream out(path, std::ios::app);
+      out << "model\n";
+      out << "model 2 1\n";
+      out << "model 18446744073709551615 1 2 3 4\n";
+      out << "model 1 abc 3 4\n";
+      out << "model 1 1 2\n";
+      out << "model 1 1 2 3 extra\n";
+      out << "not a cache file\n";
+      out << "model 1 5 6 7\n";
+    }
+    persistent_cache cache(path);
+    CHECK(cache.size() == 2);
+    CHECK(*cache.get("model", {1, 2}) == 3);
+    CHECK(*cache.get("model", {5}) == 6);
+  }
+
+  SECTION("Units")
+  {
+    persistent_cache cache(path);
+    int              calls = 0;
+    auto             f     = memoize_persistent(cache, "speed", [&calls](quantity<t::m> x, quantity<t::s> t) {
+      ++calls;
+      return x / t;
+    });
+
+    uncertain<quantity<t::m>> x(2 * i::m, 0.1 * i::m);
+    uncertain<quantity<t::s>> t(4 * i::s, 0.2 * i::s);
+    auto                      a = basic_error_propagator::propagate_error(f, x, t);
+    auto                      b = basic_error_propagator::propagate_error(f, x, t);
+    CHECK(calls == 3);
+    CHECK(b.nominal().value() == Approx(0.5));
+    CHECK(b.uncertainty().value() == Approx(a.uncertainty().value()));
+  }
+
+  SECTION("Concurrent writers")
+  {
+    std::vector<std::thread> threads;
+    for(int k = 0; k < 4; ++k) {
+      threads.emplace_back([&path, k]() {
+        persistent_cache cache(path);
+        for(int n = 0; n < 10; ++n) {
+          cache.put("model", {double(k), double(n)}, k * n);
+        }
+      });
+    }
+    for(auto& t : threads) {
+      t.join();
+    }
+    persistent_cache cache(path);
+    CHECK(cache.size() == 40);
+    CHECK(*cache.get("model", {3, 7}) == 21);
+  }
+
+  std::filesystem::remove(path);
+  std::filesystem::remove(path.string() + ".lock");
+}
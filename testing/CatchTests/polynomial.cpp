@@ -0,0 +1,123 @@
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/linear_fit.hpp>
+#include <libUncertainty/polynomial.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace libUncertainty;
+using namespace Catch;
+
+TEST_CASE("Polynomials with uncertain coefficients")
+{
+  std::array<uncertain<double>, 3> c{uncertain<double>(1, 0.1), uncertain<double>(2, 0.2), uncertain<double>(3, 0.3)};
+  correlation_matrix<double>       corr(3);
+  corr(0, 1) = 0.5;
+  corr(0, 2) = -0.2;
+  corr(1, 2) = -0.7;
+
+  auto quadratic = [](double a, double b, double c) { return [=](double x) { return a + b * x + c * x * x; }; };
+
+  SECTION("Single points")
+  {
+    uncertain_polynomial p(c, corr);
+    CHECK(p.degree() == 2);
+    for(double x : {-2., 0., 0.5, 3.}) {
+      // the polynomial is linear in the coefficients, so propagate_error(...) is exact
+      auto y = basic_error_propagator::propagate_error([&](double a, double b, double cc) { return quadratic(a, b, cc)(x); }, corr, c[0], c[1], c[2]);
+      CHECK(p(x).nominal() == Approx(y.nominal()));
+      CHECK(p(x).uncertainty() == Approx(y.uncertainty()));
+    }
+
+    // uncorrelated
+    uncertain_polynomial q(c);
+    CHECK(q(2).uncertainty() == Approx(sqrt(0.1 * 0.1 + 0.4 * 0.4 + 1.2 * 1.2)));
+  }
+
+  SECTION("Many points")
+  {
+    std::vector<double> x;
+    for(int i = 0; i < 1000; ++i) {
+      x.push_back(-5 + 0.01 * i);
+    }
+    std::vector<uncertain<double>> y;
+    evaluate_polynomial(c, corr, x.begin(), x.end(), std::back_inserter(y));
+    REQUIRE(y.size() == x.size());
+
+    uncertain_polynomial p(c, corr);
+    std::vector<double>  nominal(x.size()), uncertainty(x.size());
+    p.evaluate(x.data(), x.size(), nominal.data(), uncertainty.data());
+    for(size_t i = 0; i < x.size(); i += 97) {
+      auto z = basic_error_propagator::propagate_error([&](double a, double b, double cc) { return quadratic(a, b, cc)(x[i]); }, corr, c[0], c[1], c[2]);
+      CHECK(y[i].nominal() == Approx(z.nominal()));
+      CHECK(y[i].uncertainty() == Approx(z.uncertainty()));
+      CHECK(nominal[i] == Approx(z.nominal()));
+      CHECK(uncertainty[i] == Approx(z.uncertainty()));
+    }
+  }
+
+  SECTION("Calibration from a polynomial fit")
+  {
+    std::vector<double>            x;
+    std::vector<uncertain<double>> y;
+    for(int i = 0; i < 10; ++i) {
+      x.push_back(i);
+      y.emplace_back(1 + 2 * i + 0.5 * i * i, 0.1);
+    }
+    auto                 fit = linear_fit(polynomial_basis<2>{}, x.begin(), x.end(), y.begin());
+    uncertain_polynomial p(fit.parameters, fit.correlation);
+    auto                 z = basic_error_propagator::propagate_error([&](double a, double b, double c) { return quadratic(a, b, c)(4.5); }, fit.correlation,
+                                                                     fit.parameters[0], fit.parameters[1], fit.parameters[2]);
+    CHECK(p(4.5).nominal() == Approx(1 + 9 + 0.5 * 4.5 * 4.5));
+    CHECK(p(4.5).uncertainty() == Approx(z.uncertainty()));
+
+    uncertain_polynomial q(fit);
+    CHECK(q(4.5).nominal() == Approx(p(4.5).nominal()));
+    CHECK(q(4.5).uncertainty() == Approx(p(4.5).uncertainty()));
+  }
+
+  SECTION("Calibration from a fit to data far from x = 0")
+  {
+    // the covariance of a cubic fit to points near x = 1000 is so ill-conditioned that its elements
+    // can not give the variance. the factor of the fit does.
+    std::vector<double>            x;
+    std::vector<uncertain<double>> y;
+    for(int i = 0; i <= 100; ++i) {
+      double xi = 1000 + i * 0.1;
+      x.push_back(xi);
+      y.emplace_back(1 + xi - 1e-3 * xi * xi + 1e-6 * xi * xi * xi + 0.01 * std::sin(i), 0.01);
+    }
+    auto                 fit = linear_fit(polynomial_basis<3>{}, x.begin(), x.end(), y.begin());
+    uncertain_polynomial p(fit);
+    for(double xi : {1000., 1005., 1010., 1020.}) {
+      CHECK(p(xi).nominal() == Approx(fit.parameters[0].nominal() + xi * (fit.parameters[1].nominal() + xi * (fit.parameters[2].nominal() + xi * fit.parameters[3].nominal()))));
+      CHECK(p(xi).uncertainty() == Approx(fit.prediction_uncertainty(polynomial_basis<3>{}(xi))).epsilon(1e-6));
+    }
+    // in the middle of the data, the uncertainty is about 0.01 / sqrt(101 / 4)
+    CHECK(p(1005).uncertainty() == Approx(0.0015).epsilon(0.01));
+  }
+
+  SECTION("Errors")
+  {
+    CHECK_THROWS_AS(uncertain_polynomial(c, correlation_matrix<double>(2)), std::invalid_argument);
+    CHECK_THROWS_AS(uncertain_polynomial(std::vector<uncertain<double>>{}), std::invalid_argument);
+
+    correlation_matrix<double> invalid(3);
+    invalid(0, 1) = 0.9;
+    invalid(0, 2) = 0.9;
+    invalid(1, 2) = -0.9;
+    CHECK_THROWS_AS(uncertain_polynomial(c, invalid), std::invalid_argument);
+  }
+
+  SECTION("Fully correlated coefficients")
+  {
+    correlation_matrix<double> full(3);
+    full(0, 1) = 1;
+    uncertain_polynomial p(c, full);
+    // p(2) = c_0 + 2 c_1 + 4 c_2 with c_0 and c_1 moving together
+    CHECK(p(2).uncertainty() == Approx(sqrt(pow(0.1 + 0.4, 2) + 1.2 * 1.2)));
+  }
+}
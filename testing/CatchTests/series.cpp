@@ -0,0 +1,199 @@
+#include <BoostUnitDefinitions/Units.hpp>
+#include <cmath>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/series.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace boost::units;
+using namespace libUncertainty;
+using namespace Catch;
+
+namespace
+{
+// the covariance J diag(sigma^2) J^T of a linear transform of independent inputs
+std::vector<std::vector<double>> dense_covariance(const std::vector<std::vector<double>>& J, const std::vector<double>& sigma)
+{
+  std::vector<std::vector<double>> C(J.size(), std::vector<double>(J.size(), 0.));
+  for(size_t i = 0; i < J.size(); ++i) {
+    for(size_t j = 0; j < J.size(); ++j) {
+      for(size_t k = 0; k < sigma.size(); ++k) {
+        C[i][j] += J[i][k] * J[j][k] * sigma[k] * sigma[k];
+      }
+    }
+  }
+  return C;
+}
+}  // namespace
+
+TEST_CASE("Uncertain series")
+{
+  std::vector<double>            x     = {0, 0.5, 1.5, 2, 3, 3.5, 4};
+  std::vector<double>            sigma = {0.1, 0.2, 0.1, 0.3, 0.2, 0.1, 0.2};
+  std::vector<uncertain<double>> y;
+  for(size_t i = 0; i < x.size(); ++i) {
+    y.emplace_back(x[i] * x[i], sigma[i]);
+  }
+  size_t N = x.size();
+
+  SECTION("Banded covariance")
+  {
+    banded_covariance cov(4, 1);
+    cov(0, 0) = 4;
+    cov(1, 1) = 1;
+    cov(0, 1) = 1;
+    const auto& ccov = cov;
+    CHECK(ccov.size() == 4);
+    CHECK(ccov.bandwidth() == 1);
+    CHECK(ccov(1, 0) == Approx(1));
+    // elements outside of the band are zero, but can not be set
+    CHECK(ccov(0, 2) == 0);
+    CHECK(ccov.correlation(0, 1) == Approx(0.5));
+    CHECK_THROWS_AS(cov(0, 2) = 1, std::out_of_range);
+  }
+
+  SECTION("Cumulative sum")
+  {
+    std::vector<uncertain<double>> C;
+    cumulative_covariance          cov;
+    cumulative_sum(y.begin(), y.end(), std::back_inserter(C), &cov);
+
+    std::vector<std::vector<double>> J(N, std::vector<double>(N, 0.));
+    double                           sum = 0;
+    for(size_t i = 0; i < N; ++i) {
+      sum += y[i].nominal();
+      for(size_t k = 0; k <= i; ++k) {
+        J[i][k] = 1;
+      }
+      CHECK(C[i].nominal() == Approx(sum));
+    }
+    auto dense = dense_covariance(J, sigma);
+    REQUIRE(cov.size() == N);
+    for(size_t i = 0; i < N; ++i) {
+      CHECK(C[i].uncertainty() == Approx(sqrt(dense[i][i])));
+      for(size_t j = 0; j < N; ++j) {
+        CHECK(cov(i, j) == Approx(dense[i][j]));
+      }
+    }
+    CHECK(cov.correlation(0, 1) == Approx(0.1 / sqrt(0.05)));
+  }
+
+  SECTION("Trapezoid")
+  {
+    auto I = trapezoid(x.begin(), x.end(), y.begin());
+
+    std::vector<uncertain<double>> C;
+    cumulative_covariance          cov;
+    cumulative_trapezoid(x.begin(), x.end(), y.begin(), std::back_inserter(C), &cov);
+
+    std::vector<std::vector<double>> J(N, std::vector<double>(N, 0.));
+    for(size_t i = 1; i < N; ++i) {
+      J[i] = J[i - 1];
+      J[i][i - 1] += (x[i] - x[i - 1]) / 2;
+      J[i][i] += (x[i] - x[i - 1]) / 2;
+    }
+    auto dense = dense_covariance(J, sigma);
+    REQUIRE(C.size() == N);
+    CHECK(C[0].nominal() == Approx(0).scale(1));
+    CHECK(C[0].uncertainty() == Approx(0).scale(1));
+    for(size_t i = 0; i < N; ++i) {
+      double nominal = 0;
+      for(size_t k = 0; k < N; ++k) {
+        nominal += J[i][k] * y[k].nominal();
+      }
+      CHECK(C[i].nominal() == Approx(nominal));
+      CHECK(C[i].uncertainty() == Approx(sqrt(dense[i][i])));
+      for(size_t j = 0; j < N; ++j) {
+        CHECK(cov(i, j) == Approx(dense[i][j]));
+      }
+    }
+    CHECK(I.nominal() == Approx(C.back().nominal()));
+    CHECK(I.uncertainty() == Approx(C.back().uncertainty()));
+  }
+
+  SECTION("Simpson")
+  {
+    // simpson's rule is exact for x^2, even with uneven spacing
+    auto I = simpson(x.begin(), x.end(), y.begin());
+    CHECK(I.nominal() == Approx(64. / 3));
+
+    // uniform spacing: h/3 (y_0 + 4 y_1 + y_2)
+    std::vector<double>            xu = {0, 1, 2};
+    std::vector<uncertain<double>> yu = {{1, 0.3}, {2, 0.1}, {3, 0.3}};
+    auto                           Iu = simpson(xu.begin(), xu.end(), yu.begin());
+    CHECK(Iu.nominal() == Approx(4));
+    CHECK(Iu.uncertainty() == Approx(sqrt(0.01 + 16 * 0.01 / 9 + 0.01)));
+
+    CHECK_THROWS_AS(simpson(x.begin(), x.end() - 1, y.begin()), std::invalid_argument);
+  }
+
+  SECTION("Derivatives")
+  {
+    std::vector<uncertain<double>> D;
+    banded_covariance              cov;
+    forward_difference(x.begin(), x.end(), y.begin(), std::back_inserter(D), &cov);
+
+    std::vector<std::vector<double>> J(N - 1, std::vector<double>(N, 0.));
+    for(size_t i = 0; i + 1 < N; ++i) {
+      J[i][i]     = -1 / (x[i + 1] - x[i]);
+      J[i][i + 1] = 1 / (x[i + 1] - x[i]);
+      CHECK(D[i].nominal() == Approx(x[i + 1] + x[i]));
+    }
+    auto dense = dense_covariance(J, sigma);
+    REQUIRE(cov.size() == N - 1);
+    CHECK(cov.bandwidth() == 1);
+    for(size_t i = 0; i + 1 < N; ++i) {
+      CHECK(D[i].uncertainty() == Approx(sqrt(dense[i][i])));
+      for(size_t j = 0; j + 1 < N; ++j) {
+        CHECK(static_cast<const banded_covariance&>(cov)(i, j) == Approx(dense[i][j]).scale(1));
+      }
+    }
+    CHECK(cov.correlation(0, 1) < 0);
+
+    D.clear();
+    central_difference(x.begin(), x.end(), y.begin(), std::back_inserter(D), &cov);
+    J.assign(N, std::vector<double>(N, 0.));
+    for(size_t i = 0; i < N; ++i) {
+      size_t a = i > 0 ? i - 1 : 0, b = i + 1 < N ? i + 1 : N - 1;
+      J[i][a]  = -1 / (x[b] - x[a]);
+      J[i][b]  = 1 / (x[b] - x[a]);
+    }
+    dense = dense_covariance(J, sigma);
+    REQUIRE(D.size() == N);
+    CHECK(cov.bandwidth() == 2);
+    CHECK(D[2].nominal() == Approx(x[3] + x[1]));
+    for(size_t i = 0; i < N; ++i) {
+      CHECK(D[i].uncertainty() == Approx(sqrt(dense[i][i])));
+      for(size_t j = 0; j < N; ++j) {
+        CHECK(static_cast<const banded_covariance&>(cov)(i, j) == Approx(dense[i][j]).scale(1));
+      }
+    }
+    // neighbors do not share a point, next-neighbors share one (with opposite signs)
+    CHECK(cov.correlation(2, 3) == Approx(0).scale(1));
+    CHECK(cov.correlation(1, 3) < 0);
+
+    CHECK_THROWS_AS(forward_difference(x.begin(), x.begin() + 1, y.begin(), std::back_inserter(D)), std::invalid_argument);
+  }
+
+  SECTION("Quantities")
+  {
+    std::vector<quantity<t::s>>            t = {0. * i::s, 1. * i::s, 2. * i::s};
+    std::vector<uncertain<quantity<t::m>>> d = {{1. * i::m, 0.1 * i::m}, {2. * i::m, 0.1 * i::m}, {3. * i::m, 0.1 * i::m}};
+
+    auto I = trapezoid(t.begin(), t.end(), d.begin());
+    CHECK(I.nominal().value() == Approx(4));
+    CHECK(I.uncertainty().value() == Approx(sqrt(0.25 + 1 + 0.25) * 0.1));
+
+    std::vector<uncertain<quantity<t::m>>> C;
+    cumulative_sum(d.begin(), d.end(), std::back_inserter(C));
+    CHECK(C[2].nominal().value() == Approx(6));
+    CHECK(C[2].uncertainty().value() == Approx(sqrt(3) * 0.1));
+
+    // velocity
+    std::vector<uncertain<decltype(quantity<t::m>() / quantity<t::s>())>> v;
+    central_difference(t.begin(), t.end(), d.begin(), std::back_inserter(v));
+    CHECK(v[1].nominal().value() == Approx(1));
+    CHECK(v[1].uncertainty().value() == Approx(sqrt(2) * 0.1 / 2));
+  }
+}
@@ -0,0 +1,108 @@
+#include <cmath>
+#include <sstream>
+
+#include <BoostUnitDefinitions/Units.hpp>
+
+#include <catch2/catch_all.hpp>
+#include <libUncertainty/correlation.hpp>
+#include <libUncertainty/propagate.hpp>
+#include <libUncertainty/tracing.hpp>
+#include <libUncertainty/uncertain.hpp>
+
+using namespace boost::units;
+using namespace libUncertainty;
+using namespace Catch;
+
+TEST_CASE("Tracing")
+{
+  using tracing    = tracing_instrumentation<16>;
+  using propagator = instrumented_error_propagator<tracing>;
+  auto& tracer     = tracing::tracer();
+  tracer.clear();
+
+  uncertain<double> x(1, 0.1);
+  uncertain<double> y(2, 0.2);
+
+  SECTION("Tracing does not change the result")
+  {
+    auto a = basic_error_propagator::propagate_error([](double x, double y) { return x * y; }, x, y);
+    auto b = propagator::propagate_error([](double x, double y) { return x * y; }, x, y);
+    CHECK(b.nominal() == Approx(a.nominal()));
+    CHECK(b.uncertainty() == Approx(a.uncertainty()));
+  }
+
+  SECTION("Intermediate values are recorded")
+  {
+    propagator::propagate_error([](double x, double y) { return x + y; }, x, y);
+
+    auto events = tracer.last_call();
+    REQUIRE(events.size() == 4);
+    CHECK(events[0].kind == trace_event_kind::nominal);
+    CHECK(events[0].value == Approx(3));
+    CHECK(events[1].kind == trace_event_kind::deviation);
+    CHECK(events[1].i == 0);
+    CHECK(events[1].value == Approx(0.1));
+    CHECK(events[2].kind == trace_event_kind::deviation);
+    CHECK(events[2].i == 1);
+    CHECK(events[2].value == Approx(0.2));
+    CHECK(events[3].kind == trace_event_kind::result);
+    CHECK(events[3].value == Approx(3));
+    CHECK(events[3].uncertainty == Approx(sqrt(0.1 * 0.1 + 0.2 * 0.2)));
+    CHECK(std::string(events[3].overload) == "propagate_error");
+
+    std::stringstream out;
+    out << events[1];
+    CHECK(out.str().find("deviation[0] 0.1") != std::string::npos);
+  }
+
+  SECTION("Correlation terms are recorded")
+  {
+    correlation_matrix<double> corr(2);
+    corr(0, 1) = -1;
+    auto z     = propagator::propagate_error([](double x, double y) { return x + y; }, corr, x, y);
+    CHECK(z.uncertainty() == Approx(0.1));
+
+    auto events = tracer.last_call();
+    REQUIRE(events.size() == 5);
+    CHECK(events[3].kind == trace_event_kind::correlation_term);
+    CHECK(events[3].i == 0);
+    CHECK(events[3].j == 1);
+    CHECK(events[3].value == Approx(-2 * 0.1 * 0.2));
+  }
+
+  SECTION("Finding a NaN")
+  {
+    propagator::propagate_error([](double x, double y) { return sqrt(x - y); }, x, uncertain<double>(1, 0.1));
+
+    auto events = tracer.last_call();
+    REQUIRE(events.size() == 4);
+    CHECK(events[0].value == Approx(0));
+    CHECK(!std::isnan(events[1].value));
+    CHECK(std::isnan(events[2].value));
+    CHECK(std::isnan(events[3].uncertainty));
+  }
+
+  SECTION("Units are stripped")
+  {
+    uncertain<quantity<t::m>> l(2 * i::m, 0.01 * i::m);
+    instrumented_error_propagator<tracing>::propagate_error(tags::strip_units{}, [](quantity<t::m> l) { return 2. * l; }, l);
+
+    auto events = tracer.last_call();
+    REQUIRE(events.size() == 3);
+    CHECK(std::string(events[0].overload) == "propagate_error[strip_units]");
+    CHECK(events[1].value == Approx(0.02));
+    CHECK(events[2].uncertainty == Approx(0.02));
+  }
+
+  SECTION("Old events are overwritten")
+  {
+    for(int k = 0; k < 5; ++k) {
+      propagator::propagate_error([](double x, double y) { return x + y; }, x, y);
+    }
+    CHECK(tracer.size() == 16);
+    CHECK(tracer.dropped() == 4);
+    CHECK(tracer.events().front().kind == trace_event_kind::nominal);
+    CHECK(tracer.last_call().size() == 4);
+    CHECK(tracer.events().back().call == tracer.last_call().back().call);
+  }
+}
@@ -9,6 +9,16 @@ using namespace boost::units;
 using namespace libUncertainty;
 using namespace Catch;
 
+namespace
+{
+// a type that is not arithmetic, but can be read from and written to a stream
+struct streamable_length {
+  double meters;
+};
+std::ostream& operator<<(std::ostream& out, const streamable_length& a_val) { return out << a_val.meters; }
+std::istream& operator>>(std::istream& in, streamable_length& a_val) { return in >> a_val.meters; }
+}  // namespace
+
 TEST_CASE("Utility functions/classes Tests")
 {
   SECTION("Sigfig rounding")
@@ -19,6 +29,19 @@ TEST_CASE("Utility functions/classes Tests")
       CHECK(sigfig_round(1.23456, 2) == Approx(1.2));
       CHECK(sigfig_round(1.23456, 3) == Approx(1.23));
       CHECK(sigfig_round(1.23456, 4) == Approx(1.235));
+      CHECK(sigfig_round(-0.0098765, 2) == Approx(-0.0099));
+      CHECK(sigfig_round(6.02214e23, 3) == Approx(6.02e23));
+      CHECK(sigfig_round(1.25f, 2) == Approx(1.2));
+      CHECK(sigfig_round(12345, 2) == 12345);
+      // zero significant figures is treated as one, and more than a double holds changes nothing
+      CHECK(sigfig_round(1.23456, 0) == Approx(1));
+      CHECK(sigfig_round(1.23456, 100) == 1.23456);
+    }
+    SECTION("streamable types")
+    {
+      CHECK(sigfig_round(streamable_length{1.23456}, 2).meters == Approx(1.2));
+      CHECK(sigfig_round(streamable_length{-98765.4}, 3).meters == Approx(-98800));
+      CHECK(sigfig_round(streamable_length{1.23456}, 0).meters == Approx(1));
     }
     SECTION("boost quantities")
     {
@@ -31,6 +54,18 @@ TEST_CASE("Utility functions/classes Tests")
     }
   }
 
+  SECTION("Stripping and attaching units")
+  {
+    quantity<t::cm> x = 1.5 * i::cm;
+
+    CHECK(strip_unit(x) == Approx(1.5));
+    CHECK(strip_unit(2.5) == Approx(2.5));
+    CHECK(attach_unit<quantity<t::cm>>(1.5).value() == Approx(1.5));
+    CHECK(attach_unit<quantity<t::m>>(1.5).value() == Approx(1.5));
+    CHECK(attach_unit<double>(1.5) == Approx(1.5));
+    CHECK(attach_unit<quantity<t::cm>>(strip_unit(x)) == x);
+  }
+
   SECTION("getting unique ids")
   {
     auto id1 = get_uniq_id();
@@ -0,0 +1,18 @@
+// Compiles a consumer of the libUncertainty module and runs one propagation, so that a
+// toolchain with module support checks the exports. Built when LIBUNCERTAINTY_BUILD_MODULE is on.
+#include <cmath>
+#include <cstdio>
+
+import libUncertainty;
+
+int main()
+{
+  libUncertainty::uncertain<double> x(1, 0.1), y(2, 0.2);
+  auto z = libUncertainty::basic_error_propagator::propagate_error([](double a, double b) { return a * b; }, x, y);
+  // sqrt( (2 * 0.1)^2 + (1 * 0.2)^2 )
+  if(std::abs(z.nominal() - 2) > 1e-12 || std::abs(z.uncertainty() - std::sqrt(0.08)) > 1e-12) {
+    std::printf("module smoke test failed: %g +/- %g\n", z.nominal(), z.uncertainty());
+    return 1;
+  }
+  return 0;
+}